@@ -1 +1,13 @@
 #include "AstNode.h"
+
+void AstNode::Clear()
+{
+	name.clear();
+	type.clear();
+	computedType.clear();
+	llvmValue = nullptr;
+	isTemporaryIdentifier = false;
+	children.clear();
+	stringValue.clear();
+	literalValue = LiteralValue();
+}
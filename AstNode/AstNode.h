@@ -1,6 +1,7 @@
 #ifndef LLPARSERLIBRARYEXAMPLE_ASTNODE_H
 #define LLPARSERLIBRARYEXAMPLE_ASTNODE_H
 
+#include "LiteralValue/LiteralValue.h"
 #include <string>
 #include <vector>
 #include <llvm/IR/Value.h>
@@ -8,14 +9,17 @@
 class AstNode
 {
 public:
+	void Clear();
+
 	std::string name;
 	std::string type;
 	std::string computedType;
-	llvm::Value * llvmValue;
+	llvm::Value * llvmValue = nullptr;
 	bool isTemporaryIdentifier = false;
 	std::vector<AstNode*> children;
 
 	std::string stringValue;
+	LiteralValue literalValue;
 };
 
 #endif
@@ -0,0 +1,133 @@
+#include "LiteralValue.h"
+#include "../../LexerLibrary/TokenLibrary/TokenConstant/TokenConstant.h"
+#include <charconv>
+
+bool LiteralValue::Parse(std::string const & type, std::string const & text, LiteralValue & result)
+{
+	char const * begin = text.data();
+	char const * end = text.data() + text.size();
+	if (type == TokenConstant::CoreType::Number::INTEGER)
+	{
+		int64_t value;
+		std::from_chars_result parseResult = std::from_chars(begin, end, value);
+		if (parseResult.ec != std::errc() || parseResult.ptr != end)
+		{
+			return false;
+		}
+		result = LiteralValue(value);
+
+		return true;
+	}
+	if (type == TokenConstant::CoreType::Number::FLOAT)
+	{
+		double value;
+		std::from_chars_result parseResult = std::from_chars(begin, end, value);
+		if (parseResult.ec != std::errc() || parseResult.ptr != end)
+		{
+			return false;
+		}
+		result = LiteralValue(value);
+
+		return true;
+	}
+	if (type == TokenConstant::CoreType::BOOLEAN)
+	{
+		if (text != "True" && text != "False")
+		{
+			return false;
+		}
+		result = LiteralValue(text == "True");
+
+		return true;
+	}
+	if (type == TokenConstant::CoreType::CHARACTER)
+	{
+		if (text.size() < 3)
+		{
+			return false;
+		}
+		result = LiteralValue(text[1]);
+
+		return true;
+	}
+	return false;
+}
+
+LiteralValue::LiteralValue(std::variant<std::monostate, int64_t, double, bool, char> value)
+	: m_value(value)
+{
+}
+
+bool LiteralValue::IsEmpty() const
+{
+	return std::holds_alternative<std::monostate>(m_value);
+}
+
+bool LiteralValue::IsInteger() const
+{
+	return std::holds_alternative<int64_t>(m_value);
+}
+
+bool LiteralValue::IsFloat() const
+{
+	return std::holds_alternative<double>(m_value);
+}
+
+bool LiteralValue::IsBoolean() const
+{
+	return std::holds_alternative<bool>(m_value);
+}
+
+bool LiteralValue::IsCharacter() const
+{
+	return std::holds_alternative<char>(m_value);
+}
+
+bool LiteralValue::IsNumber() const
+{
+	return IsInteger() || IsFloat();
+}
+
+int64_t LiteralValue::GetInteger() const
+{
+	return IsFloat() ? static_cast<int64_t>(std::get<double>(m_value)) : std::get<int64_t>(m_value);
+}
+
+double LiteralValue::GetFloat() const
+{
+	return IsInteger() ? static_cast<double>(std::get<int64_t>(m_value)) : std::get<double>(m_value);
+}
+
+bool LiteralValue::GetBoolean() const
+{
+	return std::get<bool>(m_value);
+}
+
+char LiteralValue::GetCharacter() const
+{
+	return std::get<char>(m_value);
+}
+
+std::string LiteralValue::ToString() const
+{
+	if (IsInteger())
+	{
+		return std::to_string(std::get<int64_t>(m_value));
+	}
+	if (IsFloat())
+	{
+		char buffer[32];
+		std::to_chars_result toCharsResult = std::to_chars(buffer, buffer + sizeof(buffer), std::get<double>(m_value));
+
+		return std::string(buffer, toCharsResult.ptr);
+	}
+	if (IsBoolean())
+	{
+		return std::get<bool>(m_value) ? "True" : "False";
+	}
+	if (IsCharacter())
+	{
+		return std::string("'") + std::get<char>(m_value) + "'";
+	}
+	return "";
+}
@@ -0,0 +1,33 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_LITERALVALUE_H
+#define LLPARSERLIBRARYEXAMPLE_LITERALVALUE_H
+
+#include <cstdint>
+#include <string>
+#include <variant>
+
+// Value of a literal or of a folded constant expression, parsed once from the token text.
+class LiteralValue
+{
+public:
+	static bool Parse(std::string const & type, std::string const & text, LiteralValue & result);
+
+	explicit LiteralValue(std::variant<std::monostate, int64_t, double, bool, char> value = std::monostate());
+
+	bool IsEmpty() const;
+	bool IsInteger() const;
+	bool IsFloat() const;
+	bool IsBoolean() const;
+	bool IsCharacter() const;
+	bool IsNumber() const;
+
+	int64_t GetInteger() const;
+	double GetFloat() const;
+	bool GetBoolean() const;
+	char GetCharacter() const;
+	std::string ToString() const;
+
+private:
+	std::variant<std::monostate, int64_t, double, bool, char> m_value;
+};
+
+#endif
@@ -0,0 +1,89 @@
+#include "BatchCompiler.h"
+#include "../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include <sstream>
+
+BatchCompiler::BatchCompiler(
+	std::string const & ruleFileName,
+	CompileOptions const & compileOptions,
+	size_t threadCount
+)
+	: m_llTableBuilder(std::make_shared<LLTableBuilder>(ruleFileName))
+	, m_compileOptions(compileOptions)
+	, m_threadPool(threadCount)
+	, m_workerParsers(m_threadPool.GetThreadCount())
+{
+}
+
+void BatchCompiler::SetCompileCache(std::shared_ptr<CompileCache> compileCache)
+{
+	m_compileCache = std::move(compileCache);
+}
+
+void BatchCompiler::Compile(std::vector<BatchInput> const & inputs, std::vector<BatchResult> & results)
+{
+	size_t const firstResultIndex = results.size();
+	results.resize(firstResultIndex + inputs.size());
+	for (size_t i = 0; i < inputs.size(); ++i)
+	{
+		BatchInput const & input = inputs[i];
+		BatchResult & result = results[firstResultIndex + i];
+		m_threadPool.Submit([this, &input, &result]
+		{
+			CompileInput(input, result);
+		});
+	}
+	m_threadPool.Wait();
+}
+
+void BatchCompiler::CompileInput(BatchInput const & input, BatchResult & result)
+{
+	std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
+	std::ostringstream diagnosticOutput;
+	std::ostringstream recodeOutput;
+	std::ostringstream executionOutput;
+	llvm::raw_string_ostream irOutput(result.ir);
+
+	CompileOptions compileOptions = m_compileOptions;
+	compileOptions.diagnosticOutput = m_compileOptions.diagnosticOutput != nullptr ? &diagnosticOutput : nullptr;
+	compileOptions.recodeOutput = m_compileOptions.recodeOutput != nullptr ? &recodeOutput : nullptr;
+	compileOptions.irOutput = m_compileOptions.irOutput != nullptr ? &irOutput : nullptr;
+	compileOptions.executionOutput = m_compileOptions.executionOutput != nullptr ? &executionOutput : nullptr;
+	compileOptions.emitObject = m_compileOptions.emitObject && !input.objectFileName.empty();
+	compileOptions.objectFileName = input.objectFileName;
+	compileOptions.execute = false;
+
+	LLParser & parser = GetWorkerParser();
+	parser.Reset();
+	parser.SetCompileOptions(compileOptions);
+	parser.SetCompileCache(m_compileCache);
+	std::vector<TokenInformation> tokenInformations;
+	result.inputFileName = input.inputFileName;
+	result.objectFileName = input.objectFileName;
+	result.isCompiled = parser.IsValid(input.inputFileName, tokenInformations, result.failIndex, result.expectedTokens);
+	if (result.isCompiled && m_compileOptions.emitObject && m_compileOptions.runSemanticAnalysis && input.objectFileName.empty())
+	{
+		result.isCompiled = parser.Emit(EmissionKind::OBJECT, result.object);
+	}
+	if (result.isCompiled && m_compileOptions.execute && m_compileOptions.runSemanticAnalysis)
+	{
+		int exitCode;
+		result.isCompiled = parser.Execute(exitCode);
+	}
+
+	result.compileResult = parser.GetCompileResult();
+	irOutput.flush();
+	result.diagnostics = diagnosticOutput.str();
+	result.recode = recodeOutput.str();
+	result.output = executionOutput.str();
+	result.compileTime = std::chrono::steady_clock::now() - startTime;
+}
+
+LLParser & BatchCompiler::GetWorkerParser()
+{
+	std::unique_ptr<LLParser> & parser = m_workerParsers[m_threadPool.GetCurrentWorkerIndex()];
+	if (parser == nullptr)
+	{
+		parser = std::make_unique<LLParser>(m_llTableBuilder);
+	}
+	return *parser;
+}
@@ -0,0 +1,37 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_BATCHCOMPILER_H
+#define LLPARSERLIBRARYEXAMPLE_BATCHCOMPILER_H
+
+#include "../LLParser.h"
+#include "BatchInput/BatchInput.h"
+#include "BatchResult/BatchResult.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Compiles independent inputs on a work-stealing pool.
+// Every worker reuses one LLParser with its own LLVM context; all of them share the parse table.
+class BatchCompiler
+{
+public:
+	BatchCompiler(
+		std::string const & ruleFileName,
+		CompileOptions const & compileOptions,
+		size_t threadCount = std::thread::hardware_concurrency()
+	);
+
+	void SetCompileCache(std::shared_ptr<CompileCache> compileCache);
+	void Compile(std::vector<BatchInput> const & inputs, std::vector<BatchResult> & results);
+
+private:
+	void CompileInput(BatchInput const & input, BatchResult & result);
+	LLParser & GetWorkerParser();
+
+	std::shared_ptr<LLTableBuilder> m_llTableBuilder;
+	CompileOptions m_compileOptions;
+	std::shared_ptr<CompileCache> m_compileCache;
+	ThreadPool m_threadPool;
+	std::vector<std::unique_ptr<LLParser>> m_workerParsers;
+};
+
+#endif
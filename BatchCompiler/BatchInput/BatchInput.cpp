@@ -0,0 +1 @@
+#include "BatchInput.h"
@@ -0,0 +1,14 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_BATCHINPUT_H
+#define LLPARSERLIBRARYEXAMPLE_BATCHINPUT_H
+
+#include <string>
+
+// An empty object file name keeps the object code in memory, in BatchResult::object.
+class BatchInput
+{
+public:
+	std::string inputFileName;
+	std::string objectFileName;
+};
+
+#endif
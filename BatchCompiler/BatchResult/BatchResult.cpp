@@ -0,0 +1 @@
+#include "BatchResult.h"
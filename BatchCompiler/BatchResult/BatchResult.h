@@ -0,0 +1,30 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_BATCHRESULT_H
+#define LLPARSERLIBRARYEXAMPLE_BATCHRESULT_H
+
+#include "../../LexerLibrary/TokenLibrary/Token.h"
+#include "../../CompileResult/CompileResult.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <llvm/Support/MemoryBuffer.h>
+
+class BatchResult
+{
+public:
+	std::string inputFileName;
+	std::string objectFileName;
+	bool isCompiled = false;
+	size_t failIndex = 0;
+	std::unordered_set<Token> expectedTokens;
+	std::string diagnostics;
+	std::string recode;
+	std::string ir;
+	std::string output;
+	std::unique_ptr<llvm::MemoryBuffer> object;
+	CompileResult compileResult;
+	std::chrono::steady_clock::duration compileTime { 0 };
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "../../BatchCompiler/BatchCompiler.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures how batch compilation scales with the number of workers: the given programs are repeated
+// to form one workload, which is compiled to in-memory objects with 1, 2, 4, ... threads up to the hardware concurrency.
+int main(int argc, char * argv[])
+{
+	if (argc < 4)
+	{
+		std::cerr << "Usage: " << argv[0] << " <rule file> <repetitions> <program file>...\n";
+
+		return 2;
+	}
+	size_t const repetitions = std::stoul(argv[2]);
+	std::vector<BatchInput> inputs;
+	for (size_t i = 0; i < repetitions; ++i)
+	{
+		for (int j = 3; j < argc; ++j)
+		{
+			inputs.emplace_back();
+			inputs.back().inputFileName = argv[j];
+		}
+	}
+	CompileOptions compileOptions;
+	compileOptions.execute = false;
+	compileOptions.recodeOutput = nullptr;
+	compileOptions.irOutput = nullptr;
+	compileOptions.executionOutput = nullptr;
+
+	size_t const maxThreadCount = std::max(1u, std::thread::hardware_concurrency());
+	double singleThreadTime = 0;
+	for (size_t threadCount = 1; ; threadCount = std::min(threadCount * 2, maxThreadCount))
+	{
+		BatchCompiler batchCompiler(argv[1], compileOptions, threadCount);
+		std::vector<BatchResult> results;
+		std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
+		batchCompiler.Compile(inputs, results);
+		std::chrono::duration<double> const time = std::chrono::steady_clock::now() - startTime;
+		size_t const compiledCount = std::count_if(
+			results.begin(), results.end(), [](BatchResult const & result) { return result.isCompiled; });
+		if (threadCount == 1)
+		{
+			singleThreadTime = time.count();
+		}
+		std::cout << threadCount << " threads: " << inputs.size() / time.count() << " inputs/s, speedup "
+			<< singleThreadTime / time.count() << ", compiled " << compiledCount << "/" << inputs.size() << "\n";
+		if (threadCount == maxThreadCount)
+		{
+			break;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "../../LLParser.h"
+#include "../../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include <chrono>
+#include <iostream>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/IR/Instructions.h>
+
+// Compiles a program and checks that the stack frame of its main function does not depend on how often its loops run:
+// every alloca has to be static and sit in the entry block. CTest runs it on LoopDeclarations.txt, a million-iteration
+// loop that declares arrays in its body; the program is then executed to show that it finishes without
+// exhausting the stack.
+int main(int argc, char * argv[])
+{
+	if (argc != 3)
+	{
+		std::cerr << "Usage: " << argv[0] << " <rule file> <program file>\n";
+
+		return 2;
+	}
+	CompileOptions compileOptions;
+	compileOptions.execute = false;
+	compileOptions.emitObject = false;
+	compileOptions.recodeOutput = nullptr;
+	compileOptions.irOutput = nullptr;
+	compileOptions.decorateOutput = false;
+	compileOptions.diagnosticOutput = &std::cerr;
+
+	LLParser parser(argv[1]);
+	parser.SetCompileOptions(compileOptions);
+	std::vector<TokenInformation> tokenInformations;
+	size_t failIndex = 0;
+	std::unordered_set<Token> expectedTokens;
+	std::unique_ptr<llvm::MemoryBuffer> bitcode;
+	if (!parser.IsValid(argv[2], tokenInformations, failIndex, expectedTokens) || !parser.Emit(EmissionKind::BITCODE, bitcode))
+	{
+		std::cerr << "Could not compile " << argv[2] << "\n";
+
+		return 1;
+	}
+	llvm::LLVMContext context;
+	llvm::Expected<std::unique_ptr<llvm::Module>> module = llvm::parseBitcodeFile(bitcode->getMemBufferRef(), context);
+	llvm::Function * mainFunction = module ? (*module)->getFunction("main") : nullptr;
+	if (mainFunction == nullptr)
+	{
+		llvm::consumeError(module.takeError());
+		std::cerr << "The compiled module has no main function\n";
+
+		return 1;
+	}
+
+	llvm::DataLayout const & dataLayout = (*module)->getDataLayout();
+	uint64_t frameSize = 0;
+	size_t allocaCount = 0;
+	size_t dynamicAllocaCount = 0;
+	for (llvm::BasicBlock & block : *mainFunction)
+	{
+		for (llvm::Instruction & instruction : block)
+		{
+			auto * alloca = llvm::dyn_cast<llvm::AllocaInst>(&instruction);
+			if (alloca == nullptr)
+			{
+				continue;
+			}
+			++allocaCount;
+			if (&block != &mainFunction->getEntryBlock() || !alloca->isStaticAlloca())
+			{
+				++dynamicAllocaCount;
+				continue;
+			}
+			frameSize += dataLayout.getTypeAllocSize(alloca->getAllocatedType());
+		}
+	}
+	std::cout << "Allocas: " << allocaCount << ", outside the entry block or dynamic: " << dynamicAllocaCount << "\n";
+	std::cout << "Static frame: " << frameSize << " bytes\n";
+	if (dynamicAllocaCount != 0)
+	{
+		std::cout << "The stack grows with the number of executed declarations\n";
+
+		return 1;
+	}
+
+	int exitCode = 0;
+	std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
+	if (!parser.Execute(exitCode))
+	{
+		return 1;
+	}
+	std::chrono::duration<double, std::milli> const executionTime = std::chrono::steady_clock::now() - startTime;
+	std::cout << "Executed in " << executionTime.count() << " ms with exit code " << exitCode << "\n";
+
+	return 0;
+}
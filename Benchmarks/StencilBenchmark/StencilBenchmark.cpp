@@ -0,0 +1,83 @@
+#include "../../LLParser.h"
+#include "../../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/IR/Instructions.h>
+
+// Measures compile time and generated code size of an array-heavy program, for example a 4-D stencil loop
+// that updates every inner element of a 4-D array from its eight neighbours. Each element access should
+// lower to a single GEP, so the GEP count stays close to the number of array accesses in the source.
+int main(int argc, char * argv[])
+{
+	if (argc != 4)
+	{
+		std::cerr << "Usage: " << argv[0] << " <rule file> <repetitions> <program file>\n";
+
+		return 2;
+	}
+	size_t const repetitions = std::stoul(argv[2]);
+	CompileOptions compileOptions;
+	compileOptions.execute = false;
+	compileOptions.emitObject = false;
+	compileOptions.recodeOutput = nullptr;
+	compileOptions.irOutput = nullptr;
+	compileOptions.decorateOutput = false;
+	compileOptions.diagnosticOutput = &std::cerr;
+
+	for (OptimizationLevel optimizationLevel : { OptimizationLevel::O0, OptimizationLevel::O2 })
+	{
+		compileOptions.optimizationLevel = optimizationLevel;
+		LLParser parser(argv[1]);
+		parser.SetCompileOptions(compileOptions);
+		std::vector<TokenInformation> tokenInformations;
+		size_t failIndex = 0;
+		std::unordered_set<Token> expectedTokens;
+		std::chrono::duration<double, std::milli> compileTime { 0 };
+		for (size_t i = 0; i < repetitions; ++i)
+		{
+			tokenInformations.clear();
+			std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
+			if (!parser.IsValid(argv[3], tokenInformations, failIndex, expectedTokens))
+			{
+				std::cerr << "Could not compile " << argv[3] << "\n";
+
+				return 1;
+			}
+			compileTime += std::chrono::steady_clock::now() - startTime;
+		}
+		std::unique_ptr<llvm::MemoryBuffer> object;
+		std::unique_ptr<llvm::MemoryBuffer> bitcode;
+		if (!parser.Emit(EmissionKind::OBJECT, object) || !parser.Emit(EmissionKind::BITCODE, bitcode))
+		{
+			return 1;
+		}
+		llvm::LLVMContext context;
+		llvm::Expected<std::unique_ptr<llvm::Module>> module = llvm::parseBitcodeFile(bitcode->getMemBufferRef(), context);
+		if (!module)
+		{
+			llvm::consumeError(module.takeError());
+
+			return 1;
+		}
+		size_t instructionCount = 0;
+		size_t getElementPointerCount = 0;
+		for (llvm::Function & function : **module)
+		{
+			for (llvm::BasicBlock & block : function)
+			{
+				for (llvm::Instruction & instruction : block)
+				{
+					++instructionCount;
+					getElementPointerCount += llvm::isa<llvm::GetElementPtrInst>(instruction) ? 1 : 0;
+				}
+			}
+		}
+		std::cout << (optimizationLevel == OptimizationLevel::O0 ? "O0" : "O2")
+			<< ": compile " << compileTime.count() / repetitions << " ms, "
+			<< instructionCount << " instructions, " << getElementPointerCount << " GEPs, "
+			<< object->getBufferSize() << " object bytes\n";
+	}
+	return 0;
+}
@@ -1,188 +1,246 @@
 #include "Calculator.h"
-#include "../LLTableBuilderLibrary/TokenLibrary/TokenExtensions/TokenExtensions.h"
+#include <cmath>
+#include <limits>
 
-bool Calculator::Add(
-	std::string const & lhs,
-	std::string const & rhs,
-	std::string const & type,
-	std::string & result,
-	std::string & errorMessage
-)
+bool Calculator::Add(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage)
 {
-	Token token;
-	if (!TokenExtensions::CreateFromString(type, token))
+	if (!CheckOperands(lhs, rhs, "adding", errorMessage))
 	{
-		errorMessage = "Unknown type \"" + type + "\"" + "\n";
-
 		return false;
 	}
-	switch (token)
+	if (lhs.IsFloat() || rhs.IsFloat())
 	{
-		case Token::INTEGER:
-			result = std::to_string(stoi(lhs) + stoi(rhs));
-			break;
-		case Token::FLOAT:
-			result = std::to_string(stof(lhs) + stof(rhs));
-			break;
-		default:
-			errorMessage = "Unsupported type for adding: \"" + type + "\"" + "\n";
+		result = LiteralValue(lhs.GetFloat() + rhs.GetFloat());
 
-			return false;
+		return true;
 	}
-	return true;
+	return CreateInteger(lhs.GetInteger() + rhs.GetInteger(), result, errorMessage);
 }
 
-bool Calculator::Subtract(
-	std::string const & lhs,
-	std::string const & rhs,
-	std::string const & type,
-	std::string & result,
-	std::string & errorMessage
-)
+bool Calculator::Subtract(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage)
 {
-	Token token;
-	if (!TokenExtensions::CreateFromString(type, token))
+	if (!CheckOperands(lhs, rhs, "subtracting", errorMessage))
+	{
+		return false;
+	}
+	if (lhs.IsFloat() || rhs.IsFloat())
 	{
-		errorMessage = "Unknown type \"" + type + "\"" + "\n";
+		result = LiteralValue(lhs.GetFloat() - rhs.GetFloat());
+
+		return true;
+	}
+	return CreateInteger(lhs.GetInteger() - rhs.GetInteger(), result, errorMessage);
+}
 
+bool Calculator::Multiply(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage)
+{
+	if (!CheckOperands(lhs, rhs, "multiplying", errorMessage))
+	{
 		return false;
 	}
-	switch (token)
+	if (lhs.IsFloat() || rhs.IsFloat())
 	{
-		case Token::INTEGER:
-			result = std::to_string(stoi(lhs) - stoi(rhs));
-			break;
-		case Token::FLOAT:
-			result = std::to_string(stof(lhs) - stof(rhs));
-			break;
-		default:
-			errorMessage = "Unsupported type for subtracting: \"" + type + "\"" + "\n";
+		result = LiteralValue(lhs.GetFloat() * rhs.GetFloat());
 
-			return false;
+		return true;
 	}
-	return true;
+	return CreateInteger(lhs.GetInteger() * rhs.GetInteger(), result, errorMessage);
 }
 
-bool Calculator::Multiply(
-	std::string const & lhs,
-	std::string const & rhs,
-	std::string const & type,
-	std::string & result,
-	std::string & errorMessage
-)
+bool Calculator::IntegerDivision(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage)
 {
-	Token token;
-	if (!TokenExtensions::CreateFromString(type, token))
+	if (!CheckOperands(lhs, rhs, "integer dividing", errorMessage))
 	{
-		errorMessage = "Unknown type \"" + type + "\"" + "\n";
 		return false;
 	}
-	switch (token)
+	if (rhs.GetInteger() == 0)
 	{
-		case Token::INTEGER:
-			result = std::to_string(stoi(lhs) * stoi(rhs));
-			break;
-		case Token::FLOAT:
-			result = std::to_string(stof(lhs) * stof(rhs));
-			break;
-		default:
-			errorMessage = "Unsupported type for multiplying: \"" + type + "\"" + "\n";
+		errorMessage = std::string("Cannot divide by zero") + "\n";
 
-			return false;
+		return false;
 	}
-	return true;
+	return CreateInteger(lhs.GetInteger() / rhs.GetInteger(), result, errorMessage);
 }
 
-bool Calculator::IntegerDivision(
-	std::string const & lhs,
-	std::string const & rhs,
-	std::string const & type,
-	std::string & result,
-	std::string & errorMessage
-)
+bool Calculator::Division(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage)
 {
-	Token token;
-	if (!TokenExtensions::CreateFromString(type, token))
+	if (!CheckOperands(lhs, rhs, "dividing", errorMessage))
 	{
-		errorMessage = "Unknown type \"" + type + "\"" + "\n";
+		return false;
+	}
+	result = LiteralValue(lhs.GetFloat() / rhs.GetFloat());
+
+	return true;
+}
 
+bool Calculator::Modulus(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage)
+{
+	if (!CheckOperands(lhs, rhs, "moduling", errorMessage))
+	{
 		return false;
 	}
-	int rhsInteger = stoi(rhs);
-	if (rhsInteger == 0)
+	if (rhs.GetInteger() == 0)
 	{
 		errorMessage = std::string("Cannot divide by zero") + "\n";
 
 		return false;
 	}
-	switch (token)
+	return CreateInteger(lhs.GetInteger() % rhs.GetInteger(), result, errorMessage);
+}
+
+bool Calculator::Equivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage)
+{
+	int ordering;
+	bool isOrdered;
+	if (!Compare(lhs, rhs, ordering, isOrdered, errorMessage))
 	{
-		case Token::INTEGER:
-		case Token::FLOAT:
-			result = std::to_string(stoi(lhs) / rhsInteger);
-			break;
-		default:
-			errorMessage = "Unsupported type for integer dividing: \"" + type + "\"" + "\n";
+		return false;
+	}
+	result = isOrdered && ordering == 0;
 
-			return false;
+	return true;
+}
+
+bool Calculator::NotEquivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage)
+{
+	int ordering;
+	bool isOrdered;
+	if (!Compare(lhs, rhs, ordering, isOrdered, errorMessage))
+	{
+		return false;
 	}
+	result = isOrdered && ordering != 0;
+
 	return true;
 }
 
-bool Calculator::Division(
-	std::string const & lhs,
-	std::string const & rhs,
-	std::string const & type,
-	std::string & result,
-	std::string & errorMessage
-)
+bool Calculator::MoreOrEquivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage)
 {
-	Token token;
-	if (!TokenExtensions::CreateFromString(type, token))
+	int ordering;
+	bool isOrdered;
+	if (!Compare(lhs, rhs, ordering, isOrdered, errorMessage))
 	{
-		errorMessage = "Unknown type \"" + type + "\"" + "\n";
+		return false;
+	}
+	result = isOrdered && ordering >= 0;
+
+	return true;
+}
 
+bool Calculator::LessOrEquivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage)
+{
+	int ordering;
+	bool isOrdered;
+	if (!Compare(lhs, rhs, ordering, isOrdered, errorMessage))
+	{
 		return false;
 	}
-	switch (token)
+	result = isOrdered && ordering <= 0;
+
+	return true;
+}
+
+bool Calculator::More(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage)
+{
+	int ordering;
+	bool isOrdered;
+	if (!Compare(lhs, rhs, ordering, isOrdered, errorMessage))
 	{
-		case Token::INTEGER:
-		case Token::FLOAT:
-			result = std::to_string(stof(lhs) / stof(rhs));
-			break;
-		default:
-			errorMessage = "Unsupported type for dividing: \"" + type + "\"" + "\n";
+		return false;
+	}
+	result = isOrdered && ordering > 0;
 
-			return false;
+	return true;
+}
+
+bool Calculator::Less(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage)
+{
+	int ordering;
+	bool isOrdered;
+	if (!Compare(lhs, rhs, ordering, isOrdered, errorMessage))
+	{
+		return false;
 	}
+	result = isOrdered && ordering < 0;
+
 	return true;
 }
 
-bool Calculator::Modulus(
-	std::string const & lhs,
-	std::string const & rhs,
-	std::string const & type,
-	std::string & result,
+bool Calculator::Compare(
+	LiteralValue const & lhs,
+	LiteralValue const & rhs,
+	int & ordering,
+	bool & isOrdered,
 	std::string & errorMessage
 )
 {
-	Token token;
-	if (!TokenExtensions::CreateFromString(type, token))
+	isOrdered = true;
+	if (lhs.IsFloat() || rhs.IsFloat())
 	{
-		errorMessage = "Unknown type \"" + type + "\"" + "\n";
+		if (!CheckOperands(lhs, rhs, "comparing", errorMessage))
+		{
+			return false;
+		}
+		double lhsValue = lhs.GetFloat();
+		double rhsValue = rhs.GetFloat();
+		isOrdered = !std::isnan(lhsValue) && !std::isnan(rhsValue);
+		ordering = (lhsValue > rhsValue) - (lhsValue < rhsValue);
+
+		return true;
+	}
+	int64_t lhsValue;
+	int64_t rhsValue;
+	if (lhs.IsInteger() && rhs.IsInteger())
+	{
+		lhsValue = lhs.GetInteger();
+		rhsValue = rhs.GetInteger();
+	}
+	else if (lhs.IsBoolean() && rhs.IsBoolean())
+	{
+		lhsValue = lhs.GetBoolean();
+		rhsValue = rhs.GetBoolean();
+	}
+	else if (lhs.IsCharacter() && rhs.IsCharacter())
+	{
+		lhsValue = static_cast<signed char>(lhs.GetCharacter());
+		rhsValue = static_cast<signed char>(rhs.GetCharacter());
+	}
+	else
+	{
+		errorMessage = "Unsupported operands for comparing: \"" + lhs.ToString() + "\", \"" + rhs.ToString() + "\"" + "\n";
 
 		return false;
 	}
-	switch (token)
+	ordering = (lhsValue > rhsValue) - (lhsValue < rhsValue);
+
+	return true;
+}
+
+bool Calculator::CheckOperands(
+	LiteralValue const & lhs,
+	LiteralValue const & rhs,
+	std::string const & operationName,
+	std::string & errorMessage
+)
+{
+	if (lhs.IsNumber() && rhs.IsNumber())
 	{
-		case Token::INTEGER:
-		case Token::FLOAT:
-			result = std::to_string(stoi(lhs) % stoi(rhs));
-			break;
-		default:
-			errorMessage = "Unsupported type for moduling: \"" + type + "\"" + "\n";
+		return true;
+	}
+	errorMessage = "Unsupported operands for " + operationName + ": \"" + lhs.ToString() + "\", \"" + rhs.ToString() + "\"" + "\n";
 
-			return false;
+	return false;
+}
+
+bool Calculator::CreateInteger(int64_t value, LiteralValue & result, std::string & errorMessage)
+{
+	if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max())
+	{
+		errorMessage = "Integer overflow in constant expression: " + std::to_string(value) + "\n";
+
+		return false;
 	}
+	result = LiteralValue(value);
+
 	return true;
 }
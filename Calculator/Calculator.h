@@ -1,53 +1,42 @@
 #ifndef LLPARSERLIBRARYEXAMPLE_CALCULATOR_H
 #define LLPARSERLIBRARYEXAMPLE_CALCULATOR_H
 
+#include "../AstNode/LiteralValue/LiteralValue.h"
 #include <string>
 
+// Folds constant operands; integers follow the 32-bit semantics of the generated code and report overflow.
+// Comparisons follow the ordered floating point predicates the generated code uses, so NaN compares false.
 class Calculator
 {
 public:
-	static bool Add(
-		std::string const & lhs,
-		std::string const & rhs,
-		std::string const & type,
-		std::string & result,
-		std::string & errorMessage
-	);
-	static bool Subtract(
-		std::string const & lhs,
-		std::string const & rhs,
-		std::string const & type,
-		std::string & result,
-		std::string & errorMessage
-	);
-	static bool Multiply(
-		std::string const & lhs,
-		std::string const & rhs,
-		std::string const & type,
-		std::string & result,
-		std::string & errorMessage
-	);
-	static bool IntegerDivision(
-		std::string const & lhs,
-		std::string const & rhs,
-		std::string const & type,
-		std::string & result,
-		std::string & errorMessage
-	);
-	static bool Division(
-		std::string const & lhs,
-		std::string const & rhs,
-		std::string const & type,
-		std::string & result,
+	static bool Add(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage);
+	static bool Subtract(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage);
+	static bool Multiply(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage);
+	static bool IntegerDivision(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage);
+	static bool Division(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage);
+	static bool Modulus(LiteralValue const & lhs, LiteralValue const & rhs, LiteralValue & result, std::string & errorMessage);
+	static bool Equivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage);
+	static bool NotEquivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage);
+	static bool MoreOrEquivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage);
+	static bool LessOrEquivalence(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage);
+	static bool More(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage);
+	static bool Less(LiteralValue const & lhs, LiteralValue const & rhs, bool & result, std::string & errorMessage);
+
+private:
+	static bool CheckOperands(
+		LiteralValue const & lhs,
+		LiteralValue const & rhs,
+		std::string const & operationName,
 		std::string & errorMessage
 	);
-	static bool Modulus(
-		std::string const & lhs,
-		std::string const & rhs,
-		std::string const & type,
-		std::string & result,
+	static bool Compare(
+		LiteralValue const & lhs,
+		LiteralValue const & rhs,
+		int & ordering,
+		bool & isOrdered,
 		std::string & errorMessage
 	);
+	static bool CreateInteger(int64_t value, LiteralValue & result, std::string & errorMessage);
 };
 
 #endif
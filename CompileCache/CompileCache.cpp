@@ -0,0 +1,253 @@
+#include "CompileCache.h"
+#include "../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include "../LLTableBuilderLibrary/TokenLibrary/TokenExtensions/TokenExtensions.h"
+#include "../CompilerSession/CompilerSession.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/BinaryFormat/Magic.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/SHA1.h>
+
+CompileCache::CompileCache(std::string const & directoryName, std::string const & ruleFileName, size_t maxByteCount)
+	: m_directoryPath(directoryName)
+	, m_maxByteCount(maxByteCount)
+{
+	std::ifstream ruleFile(ruleFileName, std::ios::binary);
+	if (!ruleFile)
+	{
+		throw std::runtime_error("Can't open rule file \"" + ruleFileName + "\"");
+	}
+	std::string ruleFileContent((std::istreambuf_iterator<char>(ruleFile)), std::istreambuf_iterator<char>());
+	llvm::SHA1 hasher;
+	hasher.update(ruleFileContent);
+	m_ruleFileHash = llvm::toHex(hasher.final());
+
+	std::filesystem::create_directories(m_directoryPath);
+	for (std::filesystem::directory_entry const & entry : std::filesystem::directory_iterator(m_directoryPath))
+	{
+		if (!IsTemporaryFile(entry.path()))
+		{
+			m_byteCount += GetFileSize(entry.path());
+		}
+	}
+	Evict();
+}
+
+std::string CompileCache::CreateKey(
+	std::vector<TokenInformation> const & tokenInformations,
+	CompileOptions const & compileOptions
+) const
+{
+	llvm::SHA1 hasher;
+	for (TokenInformation const & tokenInformation : tokenInformations)
+	{
+		hasher.update(TokenExtensions::ToString(tokenInformation.GetToken()));
+		hasher.update(llvm::StringRef("\0", 1));
+		hasher.update(tokenInformation.GetTokenStreamString().string);
+		hasher.update(llvm::StringRef("\0", 1));
+	}
+	std::string targetCpu = compileOptions.targetCpu;
+	std::string targetFeatures = compileOptions.targetFeatures;
+	if (targetCpu == CompilerSession::NATIVE_CPU)
+	{
+		targetCpu = llvm::sys::getHostCPUName().str();
+		targetFeatures = CompilerSession::GetHostCpuFeatures() + "," + targetFeatures;
+	}
+	hasher.update(m_ruleFileHash);
+	hasher.update(std::to_string(static_cast<int>(compileOptions.optimizationLevel)));
+	hasher.update(compileOptions.buildSsa ? "ssa" : "memory");
+	hasher.update(std::to_string(compileOptions.stackArrayLimit));
+	hasher.update(llvm::sys::getDefaultTargetTriple());
+	hasher.update(targetCpu);
+	hasher.update(targetFeatures);
+	hasher.update(std::to_string(LOWERING_VERSION));
+	hasher.update(LLVM_VERSION_STRING);
+
+	return llvm::toHex(hasher.final(), true);
+}
+
+bool CompileCache::Load(std::string const & key, std::string const & extension, std::unique_ptr<llvm::MemoryBuffer> & buffer)
+{
+	std::filesystem::path const entryPath = GetEntryPath(key, extension);
+	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> loadedBuffer = llvm::MemoryBuffer::getFile(entryPath.string());
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!loadedBuffer)
+	{
+		++m_statistics.missCount;
+
+		return false;
+	}
+	std::error_code errorCode;
+	std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), errorCode);
+	buffer = std::move(*loadedBuffer);
+	++m_statistics.hitCount;
+	m_statistics.savedByteCount += buffer->getBufferSize();
+
+	return true;
+}
+
+void CompileCache::Store(std::string const & key, std::string const & extension, llvm::StringRef data)
+{
+	std::filesystem::path const entryPath = GetEntryPath(key, extension);
+	std::filesystem::path temporaryPath;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		temporaryPath = entryPath;
+		temporaryPath += TEMPORARY_EXTENSION + std::to_string(m_temporaryFileCount++);
+	}
+	{
+		std::ofstream output(temporaryPath, std::ios::binary);
+		output.write(data.data(), data.size());
+		if (!output)
+		{
+			return;
+		}
+	}
+	std::lock_guard<std::mutex> lock(m_mutex);
+	size_t const replacedByteCount = GetFileSize(entryPath);
+	std::error_code errorCode;
+	std::filesystem::rename(temporaryPath, entryPath, errorCode);
+	if (errorCode)
+	{
+		std::filesystem::remove(temporaryPath, errorCode);
+
+		return;
+	}
+	m_byteCount = m_byteCount - std::min(m_byteCount, replacedByteCount) + data.size();
+	m_statistics.storedByteCount += data.size();
+	Evict();
+}
+
+size_t CompileCache::Validate()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	size_t invalidEntryCount = 0;
+	std::vector<std::filesystem::path> invalidPaths;
+	for (std::filesystem::directory_entry const & entry : std::filesystem::directory_iterator(m_directoryPath))
+	{
+		if (IsTemporaryFile(entry.path()))
+		{
+			continue;
+		}
+		std::string const fileName = entry.path().filename().string();
+		std::string const key = fileName.substr(0, fileName.find('.'));
+		std::string const extension = fileName.substr(key.size());
+		bool isValid = false;
+		if (IsKey(key))
+		{
+			llvm::file_magic magic;
+			if (!llvm::identify_magic(entry.path().string(), magic))
+			{
+				isValid = extension == BITCODE_EXTENSION
+					? magic == llvm::file_magic::bitcode
+					: (extension == OBJECT_EXTENSION || extension == JIT_OBJECT_EXTENSION) && magic.is_object();
+			}
+		}
+		if (!isValid)
+		{
+			invalidPaths.emplace_back(entry.path());
+		}
+	}
+	for (std::filesystem::path const & invalidPath : invalidPaths)
+	{
+		size_t const byteCount = GetFileSize(invalidPath);
+		std::error_code errorCode;
+		if (std::filesystem::remove(invalidPath, errorCode))
+		{
+			m_byteCount -= std::min(m_byteCount, byteCount);
+			++invalidEntryCount;
+		}
+	}
+	return invalidEntryCount;
+}
+
+CompileCacheStatistics CompileCache::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_statistics;
+}
+
+void CompileCache::notifyObjectCompiled(llvm::Module const * module, llvm::MemoryBufferRef object)
+{
+	if (IsKey(module->getModuleIdentifier()))
+	{
+		Store(module->getModuleIdentifier(), JIT_OBJECT_EXTENSION, object.getBuffer());
+	}
+}
+
+std::unique_ptr<llvm::MemoryBuffer> CompileCache::getObject(llvm::Module const * module)
+{
+	std::unique_ptr<llvm::MemoryBuffer> object;
+	if (IsKey(module->getModuleIdentifier()))
+	{
+		Load(module->getModuleIdentifier(), JIT_OBJECT_EXTENSION, object);
+	}
+	return object;
+}
+
+bool CompileCache::IsKey(std::string const & key)
+{
+	return key.size() == 40 && std::all_of(key.begin(), key.end(), [](char character)
+	{
+		return llvm::isDigit(character) || (character >= 'a' && character <= 'f');
+	});
+}
+
+bool CompileCache::IsTemporaryFile(std::filesystem::path const & path)
+{
+	return path.filename().string().find(TEMPORARY_EXTENSION) != std::string::npos;
+}
+
+size_t CompileCache::GetFileSize(std::filesystem::path const & path)
+{
+	std::error_code errorCode;
+	uintmax_t const fileSize = std::filesystem::file_size(path, errorCode);
+
+	return errorCode ? 0 : static_cast<size_t>(fileSize);
+}
+
+std::filesystem::path CompileCache::GetEntryPath(std::string const & key, std::string const & extension) const
+{
+	return m_directoryPath / (key + extension);
+}
+
+void CompileCache::Evict()
+{
+	if (m_byteCount <= m_maxByteCount)
+	{
+		return;
+	}
+	std::vector<std::filesystem::directory_entry> entries;
+	for (std::filesystem::directory_entry const & entry : std::filesystem::directory_iterator(m_directoryPath))
+	{
+		if (!IsTemporaryFile(entry.path()))
+		{
+			entries.emplace_back(entry);
+		}
+	}
+	std::sort(entries.begin(), entries.end(), [](std::filesystem::directory_entry const & left, std::filesystem::directory_entry const & right)
+	{
+		std::error_code errorCode;
+		return left.last_write_time(errorCode) < right.last_write_time(errorCode);
+	});
+	for (std::filesystem::directory_entry const & entry : entries)
+	{
+		if (m_byteCount <= m_maxByteCount)
+		{
+			break;
+		}
+		size_t const byteCount = GetFileSize(entry.path());
+		std::error_code errorCode;
+		if (std::filesystem::remove(entry.path(), errorCode))
+		{
+			m_byteCount -= std::min(m_byteCount, byteCount);
+			++m_statistics.evictedEntryCount;
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_COMPILECACHE_H
+#define LLPARSERLIBRARYEXAMPLE_COMPILECACHE_H
+
+#include "CompileCacheStatistics/CompileCacheStatistics.h"
+#include "../CompileOptions/CompileOptions.h"
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+class TokenInformation;
+
+// Content-addressed on-disk store of optimized bitcode and object code.
+// Keys hash the token stream, the rule file, the options that affect code generation, the resolved target,
+// the lowering version and the LLVM version.
+// Entries are evicted least recently used first once the directory grows past the size limit.
+// As an ORC ObjectCache it serves JIT objects for modules whose identifier is a cache key.
+class CompileCache : public llvm::ObjectCache
+{
+public:
+	static constexpr char const * BITCODE_EXTENSION = ".bc";
+	static constexpr char const * OBJECT_EXTENSION = ".o";
+	static constexpr char const * JIT_OBJECT_EXTENSION = ".jit.o";
+	// Bump whenever LLParser lowers the same program to different IR, so entries of older builds are not reused.
+	static unsigned int const LOWERING_VERSION = 3;
+
+	CompileCache(std::string const & directoryName, std::string const & ruleFileName, size_t maxByteCount);
+
+	std::string CreateKey(std::vector<TokenInformation> const & tokenInformations, CompileOptions const & compileOptions) const;
+	bool Load(std::string const & key, std::string const & extension, std::unique_ptr<llvm::MemoryBuffer> & buffer);
+	void Store(std::string const & key, std::string const & extension, llvm::StringRef data);
+	size_t Validate();
+	CompileCacheStatistics GetStatistics() const;
+
+	void notifyObjectCompiled(llvm::Module const * module, llvm::MemoryBufferRef object) override;
+	std::unique_ptr<llvm::MemoryBuffer> getObject(llvm::Module const * module) override;
+
+private:
+	// Entries are written to a temporary file first and renamed into place, so readers never see a partial entry.
+	// Directory scans leave temporary files alone, because another worker may still be writing them.
+	static constexpr char const * TEMPORARY_EXTENSION = ".tmp";
+
+	static bool IsKey(std::string const & key);
+	static bool IsTemporaryFile(std::filesystem::path const & path);
+	static size_t GetFileSize(std::filesystem::path const & path);
+	std::filesystem::path GetEntryPath(std::string const & key, std::string const & extension) const;
+	void Evict();
+
+	std::filesystem::path m_directoryPath;
+	std::string m_ruleFileHash;
+	size_t m_maxByteCount;
+	size_t m_byteCount = 0;
+	size_t m_temporaryFileCount = 0;
+	CompileCacheStatistics m_statistics;
+	mutable std::mutex m_mutex;
+};
+
+#endif
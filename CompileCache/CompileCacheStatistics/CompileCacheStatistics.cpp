@@ -0,0 +1,11 @@
+#include "CompileCacheStatistics.h"
+
+void CompileCacheStatistics::Print(std::ostream & output) const
+{
+	output << "Compile cache: "
+		<< hitCount << " hits, "
+		<< missCount << " misses, "
+		<< savedByteCount << " bytes saved, "
+		<< storedByteCount << " bytes stored, "
+		<< evictedEntryCount << " entries evicted" << std::endl;
+}
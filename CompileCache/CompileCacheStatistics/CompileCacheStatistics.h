@@ -0,0 +1,19 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_COMPILECACHESTATISTICS_H
+#define LLPARSERLIBRARYEXAMPLE_COMPILECACHESTATISTICS_H
+
+#include <cstddef>
+#include <ostream>
+
+class CompileCacheStatistics
+{
+public:
+	void Print(std::ostream & output) const;
+
+	size_t hitCount = 0;
+	size_t missCount = 0;
+	size_t savedByteCount = 0;
+	size_t storedByteCount = 0;
+	size_t evictedEntryCount = 0;
+};
+
+#endif
@@ -0,0 +1 @@
+#include "CompileOptions.h"
@@ -0,0 +1,36 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_COMPILEOPTIONS_H
+#define LLPARSERLIBRARYEXAMPLE_COMPILEOPTIONS_H
+
+#include "OptimizationLevel/OptimizationLevel.h"
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <llvm/Support/raw_ostream.h>
+
+// Selects the stages run after parsing and where their outputs go; a null output skips that output.
+// LLVM-IR is built by the semantic actions, so semantic analysis and IR construction are one stage.
+class CompileOptions
+{
+public:
+	bool runSemanticAnalysis = true;
+	bool execute = true;
+	bool emitObject = true;
+	bool pipelinedLexing = false;
+	bool decorateOutput = true;
+	std::ostream * recodeOutput = &std::cout;
+	llvm::raw_ostream * irOutput = &llvm::outs();
+	std::ostream * diagnosticOutput = &std::cout;
+	std::ostream * executionOutput = &std::cout;
+	std::string objectFileName = "output.o";
+	OptimizationLevel optimizationLevel = OptimizationLevel::O0;
+	// Keeps scalar variables in SSA values with phis instead of stack slots, so unoptimized code avoids loads and stores.
+	bool buildSsa = false;
+	// Arrays larger than this many bytes are kept off the stack: in a global at the top level, on the heap in inner scopes.
+	uint64_t stackArrayLimit = 64 * 1024;
+	// "generic", "native" for the host CPU and its features, or an explicit CPU name.
+	std::string targetCpu = "generic";
+	// Comma-separated "+feature"/"-feature" list, appended to the host features for "native".
+	std::string targetFeatures;
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_OPTIMIZATIONLEVEL_H
+#define LLPARSERLIBRARYEXAMPLE_OPTIMIZATIONLEVEL_H
+
+enum class OptimizationLevel
+{
+	O0,
+	O1,
+	O2,
+	O3,
+	OS
+};
+
+#endif
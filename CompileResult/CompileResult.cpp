@@ -0,0 +1 @@
+#include "CompileResult.h"
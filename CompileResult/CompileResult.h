@@ -0,0 +1,28 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_COMPILERESULT_H
+#define LLPARSERLIBRARYEXAMPLE_COMPILERESULT_H
+
+#include "PassTiming/PassTiming.h"
+#include <chrono>
+#include <string>
+#include <vector>
+#include <llvm/Support/CodeGen.h>
+
+// Describes how the last module was compiled.
+class CompileResult
+{
+public:
+	std::string targetTriple;
+	std::string targetCpu;
+	std::string targetFeatures;
+	llvm::Reloc::Model relocationModel = llvm::Reloc::Model::PIC_;
+	llvm::CodeModel::Model codeModel = llvm::CodeModel::Model::Small;
+	bool isCacheHit = false;
+	size_t deduplicatedConstantCount = 0;
+	std::chrono::steady_clock::duration optimizationTime { 0 };
+	std::vector<PassTiming> passTimings;
+	std::chrono::steady_clock::duration jitCompileTime { 0 };
+	std::chrono::steady_clock::duration executionTime { 0 };
+	int exitCode = 0;
+};
+
+#endif
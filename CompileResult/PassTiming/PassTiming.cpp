@@ -0,0 +1 @@
+#include "PassTiming.h"
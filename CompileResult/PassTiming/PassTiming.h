@@ -0,0 +1,17 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_PASSTIMING_H
+#define LLPARSERLIBRARYEXAMPLE_PASSTIMING_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+// Time spent in all runs of one pass; pass managers and adaptors include the passes they run.
+class PassTiming
+{
+public:
+	std::string passName;
+	size_t runCount = 0;
+	std::chrono::steady_clock::duration duration { 0 };
+};
+
+#endif
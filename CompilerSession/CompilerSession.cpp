@@ -0,0 +1,345 @@
+#include "CompilerSession.h"
+#include "../ProgramOutput/ProgramOutput.h"
+#include <mutex>
+#include <unordered_map>
+#include <llvm/ADT/Optional.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/MC/SubtargetFeature.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/PassInstrumentation.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/SmallVectorMemoryBuffer.h>
+#include <llvm/Support/TargetRegistry.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+CompilerSession::CompilerSession(std::string const & targetCpu, std::string const & targetFeatures)
+	: m_requestedTargetCpu(targetCpu)
+	, m_requestedTargetFeatures(targetFeatures)
+	, m_targetTriple(llvm::sys::getDefaultTargetTriple())
+	, m_targetCpu(targetCpu.empty() ? GENERIC_CPU : targetCpu)
+	, m_targetFeatures(targetFeatures)
+{
+	InitializeNativeTarget();
+	if (m_targetCpu == NATIVE_CPU)
+	{
+		m_targetCpu = llvm::sys::getHostCPUName().str();
+		std::string hostCpuFeatures = GetHostCpuFeatures();
+		m_targetFeatures = targetFeatures.empty() ? hostCpuFeatures : hostCpuFeatures + "," + targetFeatures;
+	}
+	llvm::Target const * target = llvm::TargetRegistry::lookupTarget(m_targetTriple, m_errorMessage);
+	if (target == nullptr)
+	{
+		return;
+	}
+	llvm::TargetOptions targetOptions;
+	llvm::Optional<llvm::Reloc::Model> relocationModel = llvm::Optional<llvm::Reloc::Model>(llvm::Reloc::Model::PIC_);
+	m_targetMachine.reset(target->createTargetMachine(m_targetTriple, m_targetCpu, m_targetFeatures, targetOptions, relocationModel));
+	if (m_targetMachine == nullptr)
+	{
+		m_errorMessage = "could not create a target machine for " + m_targetTriple;
+
+		return;
+	}
+	m_dataLayout = std::make_unique<llvm::DataLayout>(m_targetMachine->createDataLayout());
+}
+
+bool CompilerSession::IsReady() const
+{
+	return m_targetMachine != nullptr;
+}
+
+bool CompilerSession::IsCreatedFor(std::string const & targetCpu, std::string const & targetFeatures) const
+{
+	return m_requestedTargetCpu == targetCpu && m_requestedTargetFeatures == targetFeatures;
+}
+
+std::string const & CompilerSession::GetErrorMessage() const
+{
+	return m_errorMessage;
+}
+
+std::string const & CompilerSession::GetTargetTriple() const
+{
+	return m_targetTriple;
+}
+
+std::string const & CompilerSession::GetTargetCpu() const
+{
+	return m_targetCpu;
+}
+
+std::string const & CompilerSession::GetTargetFeatures() const
+{
+	return m_targetFeatures;
+}
+
+llvm::TargetMachine & CompilerSession::GetTargetMachine() const
+{
+	return *m_targetMachine;
+}
+
+llvm::DataLayout const & CompilerSession::GetDataLayout() const
+{
+	return *m_dataLayout;
+}
+
+void CompilerSession::PrepareModule(llvm::Module & module) const
+{
+	module.setTargetTriple(m_targetTriple);
+	module.setDataLayout(*m_dataLayout);
+	for (llvm::Function & function : module)
+	{
+		if (function.isDeclaration())
+		{
+			continue;
+		}
+		function.addFnAttr("target-cpu", m_targetCpu);
+		if (!m_targetFeatures.empty())
+		{
+			function.addFnAttr("target-features", m_targetFeatures);
+		}
+	}
+}
+
+bool CompilerSession::CreateJit(
+	llvm::ObjectCache * objectCache,
+	std::unique_ptr<llvm::orc::LLLazyJIT> & jit,
+	std::string & errorMessage
+) const
+{
+	llvm::orc::JITTargetMachineBuilder targetMachineBuilder((llvm::Triple(m_targetTriple)));
+	targetMachineBuilder.setCPU(m_targetCpu);
+	targetMachineBuilder.addFeatures(llvm::SubtargetFeatures(m_targetFeatures).getFeatures());
+	llvm::Expected<std::unique_ptr<llvm::orc::LLLazyJIT>> createdJit = llvm::orc::LLLazyJITBuilder()
+		.setJITTargetMachineBuilder(std::move(targetMachineBuilder))
+		.setCompileFunctionCreator([objectCache](llvm::orc::JITTargetMachineBuilder jitTargetMachineBuilder)
+			-> llvm::Expected<llvm::orc::IRCompileLayer::CompileFunction>
+		{
+			return llvm::orc::ConcurrentIRCompiler(std::move(jitTargetMachineBuilder), objectCache);
+		})
+		.create();
+	if (!createdJit)
+	{
+		errorMessage = "JIT: " + llvm::toString(createdJit.takeError()) + "\n";
+
+		return false;
+	}
+	llvm::Expected<llvm::orc::DynamicLibrarySearchGenerator> processSymbolsGenerator =
+		llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess((*createdJit)->getDataLayout().getGlobalPrefix());
+	if (!processSymbolsGenerator)
+	{
+		errorMessage = "JIT: " + llvm::toString(processSymbolsGenerator.takeError()) + "\n";
+
+		return false;
+	}
+	(*createdJit)->getMainJITDylib().setGenerator(std::move(*processSymbolsGenerator));
+	llvm::orc::SymbolMap programOutputSymbols {
+		{
+			(*createdJit)->mangleAndIntern("printf"),
+			llvm::JITEvaluatedSymbol(llvm::pointerToJITTargetAddress(&ProgramOutput::Printf), llvm::JITSymbolFlags::Exported)
+		}
+	};
+	if (llvm::Error error = (*createdJit)->getMainJITDylib().define(llvm::orc::absoluteSymbols(std::move(programOutputSymbols))))
+	{
+		errorMessage = "JIT: " + llvm::toString(std::move(error)) + "\n";
+
+		return false;
+	}
+	jit = std::move(*createdJit);
+
+	return true;
+}
+
+void CompilerSession::Optimize(
+	llvm::Module & module,
+	OptimizationLevel optimizationLevel,
+	std::vector<PassTiming> & passTimings
+) const
+{
+	if (optimizationLevel == OptimizationLevel::O0)
+	{
+		return;
+	}
+	PrepareModule(module);
+
+	std::vector<std::chrono::steady_clock::time_point> passStartTimes;
+	std::unordered_map<std::string, size_t> passNameToTimingIndex;
+	auto finishPass = [&passStartTimes, &passNameToTimingIndex, &passTimings](llvm::StringRef passName)
+	{
+		std::chrono::steady_clock::duration const duration = std::chrono::steady_clock::now() - passStartTimes.back();
+		passStartTimes.pop_back();
+		auto inserted = passNameToTimingIndex.emplace(passName.str(), passTimings.size());
+		if (inserted.second)
+		{
+			passTimings.emplace_back();
+			passTimings.back().passName = passName.str();
+		}
+		PassTiming & passTiming = passTimings[inserted.first->second];
+		++passTiming.runCount;
+		passTiming.duration += duration;
+	};
+	llvm::PassInstrumentationCallbacks instrumentationCallbacks;
+	instrumentationCallbacks.registerBeforePassCallback([&passStartTimes](llvm::StringRef, llvm::Any)
+	{
+		passStartTimes.push_back(std::chrono::steady_clock::now());
+
+		return true;
+	});
+	instrumentationCallbacks.registerAfterPassCallback([&finishPass](llvm::StringRef passName, llvm::Any)
+	{
+		finishPass(passName);
+	});
+	instrumentationCallbacks.registerAfterPassInvalidatedCallback([&finishPass](llvm::StringRef passName)
+	{
+		finishPass(passName);
+	});
+
+	llvm::PassBuilder passBuilder(m_targetMachine.get(), llvm::PipelineTuningOptions(), llvm::None, &instrumentationCallbacks);
+	llvm::LoopAnalysisManager loopAnalysisManager;
+	llvm::FunctionAnalysisManager functionAnalysisManager;
+	llvm::CGSCCAnalysisManager cgsccAnalysisManager;
+	llvm::ModuleAnalysisManager moduleAnalysisManager;
+	passBuilder.registerModuleAnalyses(moduleAnalysisManager);
+	passBuilder.registerCGSCCAnalyses(cgsccAnalysisManager);
+	passBuilder.registerFunctionAnalyses(functionAnalysisManager);
+	passBuilder.registerLoopAnalyses(loopAnalysisManager);
+	passBuilder.crossRegisterProxies(loopAnalysisManager, functionAnalysisManager, cgsccAnalysisManager, moduleAnalysisManager);
+
+	llvm::ModulePassManager modulePassManager = passBuilder.buildPerModuleDefaultPipeline(
+		ToPassBuilderOptimizationLevel(optimizationLevel));
+	modulePassManager.run(module, moduleAnalysisManager);
+}
+
+bool CompilerSession::Emit(
+	llvm::Module & module,
+	EmissionKind emissionKind,
+	llvm::raw_pwrite_stream & output,
+	std::string & errorMessage
+) const
+{
+	PrepareModule(module);
+	if (emissionKind == EmissionKind::IR)
+	{
+		module.print(output, nullptr);
+
+		return true;
+	}
+	if (emissionKind == EmissionKind::BITCODE)
+	{
+		llvm::WriteBitcodeToFile(module, output);
+
+		return true;
+	}
+	llvm::TargetMachine::CodeGenFileType const fileType = emissionKind == EmissionKind::OBJECT
+		? llvm::TargetMachine::CGFT_ObjectFile
+		: llvm::TargetMachine::CGFT_AssemblyFile;
+	llvm::legacy::PassManager passManager;
+	if (m_targetMachine->addPassesToEmitFile(passManager, output, nullptr, fileType))
+	{
+		errorMessage = "TargetMachine can't emit a file of this type\n";
+
+		return false;
+	}
+	std::unique_ptr<llvm::Module> codeGenerationModule = llvm::CloneModule(module);
+	passManager.run(*codeGenerationModule);
+
+	return true;
+}
+
+bool CompilerSession::Emit(
+	llvm::Module & module,
+	EmissionKind emissionKind,
+	std::unique_ptr<llvm::MemoryBuffer> & buffer,
+	std::string & errorMessage
+) const
+{
+	llvm::SmallVector<char, 0> bufferData;
+	llvm::raw_svector_ostream output(bufferData);
+	if (!Emit(module, emissionKind, output, errorMessage))
+	{
+		return false;
+	}
+	buffer = std::make_unique<llvm::SmallVectorMemoryBuffer>(std::move(bufferData));
+
+	return true;
+}
+
+bool CompilerSession::Emit(
+	llvm::Module & module,
+	EmissionKind emissionKind,
+	std::string const & fileName,
+	std::string & errorMessage
+) const
+{
+	std::error_code errorCode;
+	llvm::sys::fs::OpenFlags const openFlags = emissionKind == EmissionKind::IR || emissionKind == EmissionKind::ASSEMBLY
+		? llvm::sys::fs::F_Text
+		: llvm::sys::fs::F_None;
+	llvm::raw_fd_ostream output(fileName, errorCode, openFlags);
+	if (errorCode)
+	{
+		errorMessage = "Could not open file: " + errorCode.message() + "\n";
+
+		return false;
+	}
+	if (!Emit(module, emissionKind, output, errorMessage))
+	{
+		return false;
+	}
+	output.flush();
+
+	return true;
+}
+
+void CompilerSession::InitializeNativeTarget()
+{
+	static std::once_flag nativeTargetInitializedFlag;
+	std::call_once(nativeTargetInitializedFlag, []
+	{
+		llvm::InitializeNativeTarget();
+		llvm::InitializeNativeTargetAsmPrinter();
+		llvm::InitializeNativeTargetAsmParser();
+	});
+}
+
+std::string CompilerSession::GetHostCpuFeatures()
+{
+	llvm::SubtargetFeatures subtargetFeatures;
+	llvm::StringMap<bool> hostFeatures;
+	if (llvm::sys::getHostCPUFeatures(hostFeatures))
+	{
+		for (llvm::StringMapEntry<bool> const & hostFeature : hostFeatures)
+		{
+			subtargetFeatures.AddFeature(hostFeature.first(), hostFeature.second);
+		}
+	}
+	return subtargetFeatures.getString();
+}
+
+llvm::PassBuilder::OptimizationLevel CompilerSession::ToPassBuilderOptimizationLevel(OptimizationLevel optimizationLevel)
+{
+	switch (optimizationLevel)
+	{
+		case OptimizationLevel::O1:
+			return llvm::PassBuilder::OptimizationLevel::O1;
+		case OptimizationLevel::O2:
+			return llvm::PassBuilder::OptimizationLevel::O2;
+		case OptimizationLevel::O3:
+			return llvm::PassBuilder::OptimizationLevel::O3;
+		case OptimizationLevel::OS:
+			return llvm::PassBuilder::OptimizationLevel::Os;
+		default:
+			return llvm::PassBuilder::OptimizationLevel::O0;
+	}
+}
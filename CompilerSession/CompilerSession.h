@@ -0,0 +1,71 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_COMPILERSESSION_H
+#define LLPARSERLIBRARYEXAMPLE_COMPILERSESSION_H
+
+#include "EmissionKind/EmissionKind.h"
+#include "../CompileOptions/OptimizationLevel/OptimizationLevel.h"
+#include "../CompileResult/PassTiming/PassTiming.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+
+// Long-lived code generation state for the host target.
+// The native target is initialized once per process; the target machine and data layout are created once per session.
+// The "native" CPU resolves to the host CPU name and features; explicit features are appended to those.
+// A session is not thread-safe, so every thread that emits code owns its own session.
+// Object and assembly emission run the code generator on a copy, because it lowers the module in place.
+// JITs compile lazily when code is added with addLazyIRModule and at once with addIRModule.
+// JIT-compiled code prints through ProgramOutput instead of the process stdout.
+class CompilerSession
+{
+public:
+	static constexpr char const * GENERIC_CPU = "generic";
+	static constexpr char const * NATIVE_CPU = "native";
+
+	CompilerSession(std::string const & targetCpu, std::string const & targetFeatures);
+
+	static std::string GetHostCpuFeatures();
+
+	bool IsReady() const;
+	bool IsCreatedFor(std::string const & targetCpu, std::string const & targetFeatures) const;
+	std::string const & GetErrorMessage() const;
+	std::string const & GetTargetTriple() const;
+	std::string const & GetTargetCpu() const;
+	std::string const & GetTargetFeatures() const;
+	llvm::TargetMachine & GetTargetMachine() const;
+	llvm::DataLayout const & GetDataLayout() const;
+
+	void PrepareModule(llvm::Module & module) const;
+	bool CreateJit(llvm::ObjectCache * objectCache, std::unique_ptr<llvm::orc::LLLazyJIT> & jit, std::string & errorMessage) const;
+	void Optimize(llvm::Module & module, OptimizationLevel optimizationLevel, std::vector<PassTiming> & passTimings) const;
+	bool Emit(llvm::Module & module, EmissionKind emissionKind, llvm::raw_pwrite_stream & output, std::string & errorMessage) const;
+	bool Emit(
+		llvm::Module & module,
+		EmissionKind emissionKind,
+		std::unique_ptr<llvm::MemoryBuffer> & buffer,
+		std::string & errorMessage
+	) const;
+	bool Emit(llvm::Module & module, EmissionKind emissionKind, std::string const & fileName, std::string & errorMessage) const;
+
+private:
+	static void InitializeNativeTarget();
+	static llvm::PassBuilder::OptimizationLevel ToPassBuilderOptimizationLevel(OptimizationLevel optimizationLevel);
+
+	std::string m_requestedTargetCpu;
+	std::string m_requestedTargetFeatures;
+	std::string m_targetTriple;
+	std::string m_targetCpu;
+	std::string m_targetFeatures;
+	std::unique_ptr<llvm::TargetMachine> m_targetMachine;
+	std::unique_ptr<llvm::DataLayout> m_dataLayout;
+	std::string m_errorMessage;
+};
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_EMISSIONKIND_H
+#define LLPARSERLIBRARYEXAMPLE_EMISSIONKIND_H
+
+enum class EmissionKind
+{
+	OBJECT,
+	ASSEMBLY,
+	BITCODE,
+	IR
+};
+
+#endif
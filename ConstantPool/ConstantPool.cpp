@@ -0,0 +1,63 @@
+#include "ConstantPool.h"
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+
+void ConstantPool::Reset(llvm::Module * module)
+{
+	m_module = module;
+	m_globals.clear();
+	m_deduplicatedCount = 0;
+}
+
+llvm::GlobalVariable * ConstantPool::GetGlobal(llvm::Constant * constant)
+{
+	llvm::GlobalVariable *& global = m_globals[constant];
+	if (global != nullptr)
+	{
+		++m_deduplicatedCount;
+
+		return global;
+	}
+	global = new llvm::GlobalVariable(
+		*m_module, constant->getType(), true, llvm::GlobalValue::PrivateLinkage, constant, CreateName(constant));
+	global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+
+	return global;
+}
+
+llvm::Constant * ConstantPool::GetString(std::string const & value)
+{
+	llvm::Constant * data = llvm::ConstantDataArray::getString(m_module->getContext(), value);
+	llvm::GlobalVariable * global = GetGlobal(data);
+	llvm::Constant * zero = llvm::ConstantInt::get(llvm::Type::getInt32Ty(m_module->getContext()), 0);
+	llvm::Constant * indices[] = { zero, zero };
+
+	return llvm::ConstantExpr::getInBoundsGetElementPtr(data->getType(), global, indices);
+}
+
+std::string ConstantPool::CreateName(llvm::Constant * constant)
+{
+	std::string typeName;
+	llvm::raw_string_ostream typeStream(typeName);
+	constant->getType()->print(typeStream);
+	llvm::SHA1 hasher;
+	hasher.update(typeStream.str());
+	if (auto * data = llvm::dyn_cast<llvm::ConstantDataSequential>(constant))
+	{
+		hasher.update(data->getRawDataValues());
+	}
+	else
+	{
+		std::string text;
+		llvm::raw_string_ostream textStream(text);
+		constant->print(textStream);
+		hasher.update(textStream.str());
+	}
+	return "constant." + llvm::toHex(hasher.final(), true).substr(0, NAME_HASH_LENGTH);
+}
+
+size_t ConstantPool::GetDeduplicatedCount() const
+{
+	return m_deduplicatedCount;
+}
@@ -0,0 +1,31 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_CONSTANTPOOL_H
+#define LLPARSERLIBRARYEXAMPLE_CONSTANTPOOL_H
+
+#include <string>
+#include <unordered_map>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/Module.h>
+
+// Keeps one private global per distinct string or array constant of a module.
+// LLVM uniques constants by content and type, so the constant itself is the key.
+// Globals are named by a short hash of their content, which stays the same across compilations.
+class ConstantPool
+{
+public:
+	void Reset(llvm::Module * module);
+	llvm::GlobalVariable * GetGlobal(llvm::Constant * constant);
+	llvm::Constant * GetString(std::string const & value);
+	size_t GetDeduplicatedCount() const;
+
+private:
+	static size_t const NAME_HASH_LENGTH = 16;
+
+	static std::string CreateName(llvm::Constant * constant);
+
+	llvm::Module * m_module = nullptr;
+	std::unordered_map<llvm::Constant *, llvm::GlobalVariable *> m_globals;
+	size_t m_deduplicatedCount = 0;
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include "ExpressionSimplifier.h"
+#include "../LexerLibrary/TokenLibrary/TokenConstant/TokenConstant.h"
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instructions.h>
+
+bool ExpressionSimplifier::TrySimplify(
+	llvm::IRBuilder<> * builder,
+	llvm::Instruction::BinaryOps operation,
+	std::string const & resultType,
+	AstNode const & lhsNode,
+	AstNode const & rhsNode,
+	std::string const & name,
+	llvm::Value *& result
+)
+{
+	if (TryApplyIdentity(builder, operation, resultType, lhsNode, rhsNode, result))
+	{
+		return true;
+	}
+	if (resultType != TokenConstant::CoreType::Number::INTEGER)
+	{
+		return false;
+	}
+	return TryReassociate(builder, operation, lhsNode, rhsNode, name, result);
+}
+
+bool ExpressionSimplifier::TryApplyIdentity(
+	llvm::IRBuilder<> * builder,
+	llvm::Instruction::BinaryOps operation,
+	std::string const & resultType,
+	AstNode const & lhsNode,
+	AstNode const & rhsNode,
+	llvm::Value *& result
+)
+{
+	bool const isInteger = resultType == TokenConstant::CoreType::Number::INTEGER;
+	bool const isCommutative = operation == llvm::Instruction::Add || operation == llvm::Instruction::Mul;
+	bool const isAdditive = operation == llvm::Instruction::Add || operation == llvm::Instruction::Sub;
+	bool const hasNeutralValue = isAdditive || operation == llvm::Instruction::Mul
+		|| operation == llvm::Instruction::SDiv || operation == llvm::Instruction::FDiv;
+	// x + 0.0 is not x for floats: -0.0 + 0.0 is +0.0
+	bool const isExactIdentity = isInteger || operation != llvm::Instruction::Add;
+	double const neutralValue = isAdditive ? 0 : 1;
+	if (hasNeutralValue && isExactIdentity && IsLiteral(rhsNode, neutralValue) && HasType(lhsNode, resultType))
+	{
+		result = lhsNode.llvmValue;
+
+		return true;
+	}
+	if (isCommutative && isExactIdentity && IsLiteral(lhsNode, neutralValue) && HasType(rhsNode, resultType))
+	{
+		result = rhsNode.llvmValue;
+
+		return true;
+	}
+	bool const isZeroProduct = operation == llvm::Instruction::Mul && (IsLiteral(lhsNode, 0) || IsLiteral(rhsNode, 0));
+	bool const isZeroRemainder = operation == llvm::Instruction::SRem && IsLiteral(rhsNode, 1);
+	if (isInteger && (isZeroProduct || isZeroRemainder))
+	{
+		result = llvm::ConstantInt::get(builder->getInt32Ty(), 0);
+
+		return true;
+	}
+	return false;
+}
+
+bool ExpressionSimplifier::TryReassociate(
+	llvm::IRBuilder<> * builder,
+	llvm::Instruction::BinaryOps operation,
+	AstNode const & lhsNode,
+	AstNode const & rhsNode,
+	std::string const & name,
+	llvm::Value *& result
+)
+{
+	llvm::Value * lhs = lhsNode.llvmValue;
+	llvm::Value * rhs = rhsNode.llvmValue;
+	bool isInnerTemporary = lhsNode.isTemporaryIdentifier;
+	bool const isAdditive = operation == llvm::Instruction::Add || operation == llvm::Instruction::Sub;
+	if (!isAdditive && operation != llvm::Instruction::Mul)
+	{
+		return false;
+	}
+	if (operation != llvm::Instruction::Sub && llvm::isa<llvm::ConstantInt>(lhs))
+	{
+		std::swap(lhs, rhs);
+		isInnerTemporary = rhsNode.isTemporaryIdentifier;
+	}
+	auto * outerConstant = llvm::dyn_cast<llvm::ConstantInt>(rhs);
+	auto * inner = llvm::dyn_cast<llvm::BinaryOperator>(lhs);
+	if (!isInnerTemporary || outerConstant == nullptr || inner == nullptr || inner->getType() != outerConstant->getType())
+	{
+		return false;
+	}
+	llvm::Instruction::BinaryOps const innerOperation = inner->getOpcode();
+	llvm::Value * innerValue = inner->getOperand(0);
+	auto * innerConstant = llvm::dyn_cast<llvm::ConstantInt>(inner->getOperand(1));
+	if (innerConstant == nullptr && innerOperation != llvm::Instruction::Sub)
+	{
+		innerValue = inner->getOperand(1);
+		innerConstant = llvm::dyn_cast<llvm::ConstantInt>(inner->getOperand(0));
+	}
+	if (innerConstant == nullptr)
+	{
+		return false;
+	}
+
+	llvm::APInt constant;
+	if (isAdditive && (innerOperation == llvm::Instruction::Add || innerOperation == llvm::Instruction::Sub))
+	{
+		constant = innerOperation == llvm::Instruction::Add ? innerConstant->getValue() : -innerConstant->getValue();
+		constant = operation == llvm::Instruction::Add ? constant + outerConstant->getValue() : constant - outerConstant->getValue();
+		result = constant.isNullValue()
+			? innerValue
+			: builder->CreateAdd(innerValue, llvm::ConstantInt::get(builder->getContext(), constant), name);
+	}
+	else if (operation == llvm::Instruction::Mul && innerOperation == llvm::Instruction::Mul)
+	{
+		constant = innerConstant->getValue() * outerConstant->getValue();
+		result = constant.isOneValue()
+			? innerValue
+			: builder->CreateMul(innerValue, llvm::ConstantInt::get(builder->getContext(), constant), name);
+	}
+	else
+	{
+		return false;
+	}
+	if (inner->use_empty())
+	{
+		inner->eraseFromParent();
+	}
+	return true;
+}
+
+bool ExpressionSimplifier::IsLiteral(AstNode const & astNode, double value)
+{
+	return astNode.type != TokenConstant::Name::IDENTIFIER && astNode.literalValue.IsNumber() && astNode.literalValue.GetFloat() == value;
+}
+
+bool ExpressionSimplifier::HasType(AstNode const & astNode, std::string const & type)
+{
+	std::string const & astNodeType = astNode.type == TokenConstant::Name::IDENTIFIER ? astNode.computedType : astNode.type;
+
+	return astNodeType == type;
+}
@@ -0,0 +1,45 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_EXPRESSIONSIMPLIFIER_H
+#define LLPARSERLIBRARYEXAMPLE_EXPRESSIONSIMPLIFIER_H
+
+#include "../AstNode/AstNode.h"
+#include <string>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstrTypes.h>
+
+// Simplifies arithmetic with at least one non constant operand before it is emitted:
+// algebraic identities (x + 0, x * 1, x * 0, ...) and reassociation of integer constants ((x + 1) + 2 -> x + 3).
+class ExpressionSimplifier
+{
+public:
+	static bool TrySimplify(
+		llvm::IRBuilder<> * builder,
+		llvm::Instruction::BinaryOps operation,
+		std::string const & resultType,
+		AstNode const & lhsNode,
+		AstNode const & rhsNode,
+		std::string const & name,
+		llvm::Value *& result
+	);
+
+private:
+	static bool TryApplyIdentity(
+		llvm::IRBuilder<> * builder,
+		llvm::Instruction::BinaryOps operation,
+		std::string const & resultType,
+		AstNode const & lhsNode,
+		AstNode const & rhsNode,
+		llvm::Value *& result
+	);
+	static bool TryReassociate(
+		llvm::IRBuilder<> * builder,
+		llvm::Instruction::BinaryOps operation,
+		AstNode const & lhsNode,
+		AstNode const & rhsNode,
+		std::string const & name,
+		llvm::Value *& result
+	);
+	static bool IsLiteral(AstNode const & astNode, double value);
+	static bool HasType(AstNode const & astNode, std::string const & type);
+};
+
+#endif
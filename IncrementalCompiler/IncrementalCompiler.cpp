@@ -0,0 +1,519 @@
+#include "IncrementalCompiler.h"
+#include "../LexerLibrary/Lexer.h"
+#include "../LexerLibrary/TokenLibrary/TokenConstant/TokenConstant.h"
+#include "../LLTableBuilderLibrary/TokenLibrary/TokenExtensions/TokenExtensions.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+
+IncrementalCompiler::IncrementalCompiler(std::string const & ruleFileName)
+	: m_llTableBuilder(std::make_shared<LLTableBuilder>(ruleFileName))
+	, m_parser(m_llTableBuilder)
+	, m_syntaxValidator(m_llTableBuilder->GetTable())
+{
+	SetCompileOptions(m_compileOptions);
+	llvm::SmallString<128> regionFileName;
+	if (std::error_code errorCode = llvm::sys::fs::createTemporaryFile("llparser_incremental", "txt", regionFileName))
+	{
+		if (m_compileOptions.diagnosticOutput != nullptr)
+		{
+			*m_compileOptions.diagnosticOutput << "Could not create the incremental lexer file: " << errorCode.message() << "\n";
+		}
+		return;
+	}
+	m_regionFileName = regionFileName.str().str();
+}
+
+IncrementalCompiler::~IncrementalCompiler()
+{
+	if (!m_regionFileName.empty())
+	{
+		llvm::sys::fs::remove(m_regionFileName);
+	}
+}
+
+void IncrementalCompiler::SetCompileOptions(CompileOptions const & compileOptions)
+{
+	m_compileOptions = compileOptions;
+	m_compileOptions.execute = false;
+	m_compileOptions.emitObject = false;
+	m_compileOptions.recodeOutput = nullptr;
+	m_compileOptions.irOutput = nullptr;
+	m_compileOptions.runSemanticAnalysis = true;
+	// The modules live in the parser's LLVM context, which the reset replaces, so every statement is lowered again
+	std::set<size_t> pendingIndices;
+	for (std::unique_ptr<IncrementalStatement> & statement : m_statements)
+	{
+		statement->module.reset();
+		statement->declarations.clear();
+		statement->isValid = false;
+		pendingIndices.emplace(statement->index);
+	}
+	m_invalidStatementCount = m_statements.size();
+	m_declaringStatements.clear();
+	m_parser.Reset();
+	m_parser.SetCompileOptions(m_compileOptions);
+	IncrementalResult result;
+	CompilePending(pendingIndices, result);
+}
+
+bool IncrementalCompiler::Open(std::string const & inputFileName, IncrementalResult & result)
+{
+	result = IncrementalResult();
+	std::ifstream inputFile(inputFileName);
+	if (!inputFile)
+	{
+		return false;
+	}
+	m_lines.clear();
+	std::string line;
+	while (std::getline(inputFile, line))
+	{
+		m_lines.emplace_back(line);
+	}
+	Clear();
+
+	return Rebuild(0, 0, 0, m_lines.size(), result);
+}
+
+bool IncrementalCompiler::Edit(size_t firstLine, size_t lastLine, std::string const & text, IncrementalResult & result)
+{
+	result = IncrementalResult();
+	if (firstLine > lastLine || lastLine > m_lines.size() || m_statements.empty())
+	{
+		return false;
+	}
+	std::vector<std::string> lines;
+	SplitLines(text, lines);
+	// The statement before the edited lines is taken in as well, so that text added after it may continue it
+	size_t const from = FindStatementIndex(firstLine == 0 ? 0 : firstLine - 1);
+	size_t const to = FindStatementIndex(std::max(lastLine, firstLine + 1) - 1) + 1;
+	long const lineDelta = static_cast<long>(lines.size()) - static_cast<long>(lastLine - firstLine);
+	size_t const regionEndLine = m_statements[to - 1]->firstLine + m_statements[to - 1]->lineCount + lineDelta;
+	m_lines.erase(m_lines.begin() + firstLine, m_lines.begin() + lastLine);
+	m_lines.insert(m_lines.begin() + firstLine, lines.begin(), lines.end());
+	for (size_t i = to; i < m_statements.size(); ++i)
+	{
+		m_statements[i]->firstLine += lineDelta;
+	}
+	return Rebuild(from, to, m_statements[from]->firstLine, regionEndLine, result);
+}
+
+void IncrementalCompiler::PrintIr(llvm::raw_ostream & output) const
+{
+	for (std::unique_ptr<IncrementalStatement> const & statement : m_statements)
+	{
+		if (statement->module != nullptr)
+		{
+			statement->module->print(output, nullptr);
+		}
+	}
+}
+
+void IncrementalCompiler::Clear()
+{
+	// The modules have to go before the reset replaces the LLVM context they live in
+	m_statements.clear();
+	m_declaringStatements.clear();
+	m_referencingStatements.clear();
+	m_invalidStatementCount = 0;
+	m_parser.Reset();
+	m_parser.SetCompileOptions(m_compileOptions);
+}
+
+bool IncrementalCompiler::Rebuild(size_t from, size_t to, size_t regionFirstLine, size_t regionEndLine, IncrementalResult & result)
+{
+	std::vector<TokenInformation> tokenInformations;
+	while (true)
+	{
+		tokenInformations.clear();
+		if (!ReadTokenInformations(regionFirstLine, regionEndLine, tokenInformations))
+		{
+			return false;
+		}
+		result.relexedLineCount += regionEndLine - regionFirstLine;
+		// A region that does not end where a statement ends, e.g. after an opened block, takes in its neighbours,
+		// twice as many each time, so that an unbalanced bracket costs no more than lexing the rest of the source twice
+		size_t const extension = std::max<size_t>(to - from, 1);
+		if (from > 0 && !IsStatementBoundary(m_statements[from - 1]->tokenInformations, tokenInformations))
+		{
+			from -= std::min(from, extension);
+			regionFirstLine = m_statements[from]->firstLine;
+		}
+		else if (to < m_statements.size() && !IsStatementBoundary(tokenInformations, m_statements[to]->tokenInformations))
+		{
+			to = std::min(m_statements.size(), to + extension);
+			regionEndLine = m_statements[to - 1]->firstLine + m_statements[to - 1]->lineCount;
+		}
+		else
+		{
+			break;
+		}
+	}
+	result.firstChangedLine = regionFirstLine;
+	result.changedLineCount = regionEndLine - regionFirstLine;
+
+	std::vector<std::unique_ptr<IncrementalStatement>> statements;
+	SplitStatements(tokenInformations, regionFirstLine, regionEndLine, statements);
+	size_t const statementCount = statements.size();
+	std::unordered_set<std::string> changedNames;
+	for (size_t i = from; i < to; ++i)
+	{
+		IncrementalStatement & previousStatement = *m_statements[i];
+		DetachDeclarations(previousStatement);
+		RemoveReferences(&previousStatement);
+		m_invalidStatementCount -= previousStatement.isValid ? 0 : 1;
+		if (i - from < statementCount)
+		{
+			// A statement in the place of an earlier one keeps its globals, so users of unchanged declarations stay as they are
+			statements[i - from]->id = previousStatement.id;
+			statements[i - from]->declarations = std::move(previousStatement.declarations);
+			continue;
+		}
+		for (std::pair<std::string const, std::string> const & declaration : previousStatement.declarations)
+		{
+			changedNames.emplace(declaration.first);
+		}
+	}
+	for (size_t i = to - from; i < statementCount; ++i)
+	{
+		statements[i]->id = m_nextStatementId++;
+	}
+	m_invalidStatementCount += statementCount;
+	m_statements.erase(m_statements.begin() + from, m_statements.begin() + to);
+	m_statements.insert(
+		m_statements.begin() + from,
+		std::make_move_iterator(statements.begin()),
+		std::make_move_iterator(statements.end()));
+	for (size_t i = from; i < m_statements.size(); ++i)
+	{
+		m_statements[i]->index = i;
+	}
+
+	std::set<size_t> pendingIndices;
+	for (size_t i = from; i < from + statementCount; ++i)
+	{
+		AddReferences(m_statements[i].get());
+		pendingIndices.emplace(i);
+	}
+	for (std::string const & name : changedNames)
+	{
+		AddDependents(name, from, pendingIndices);
+	}
+	CompilePending(pendingIndices, result);
+	result.statementCount = m_statements.size();
+	result.isValid = m_invalidStatementCount == 0;
+
+	return result.isValid;
+}
+
+void IncrementalCompiler::SplitStatements(
+	std::vector<TokenInformation> & tokenInformations,
+	size_t regionFirstLine,
+	size_t regionEndLine,
+	std::vector<std::unique_ptr<IncrementalStatement>> & statements
+) const
+{
+	long const lexerFirstLine = StreamPosition().GetLine();
+	std::vector<size_t> boundaries;
+	tokenInformations.emplace_back(m_endTokenInformation);
+	m_syntaxValidator.FindStatementBoundaries(tokenInformations, boundaries);
+	tokenInformations.pop_back();
+	std::vector<size_t> tokenStarts { 0 };
+	std::vector<size_t> lineStarts { regionFirstLine };
+	for (size_t boundary : boundaries)
+	{
+		if (boundary == 0)
+		{
+			continue;
+		}
+		// Statements that share a line stay together, and a line comment after a statement belongs to it
+		long const line = tokenInformations[boundary - 1].GetTokenStreamString().position.GetLine();
+		size_t next = boundary;
+		while (next < tokenInformations.size()
+			&& tokenInformations[next].GetTokenStreamString().position.GetLine() == line
+			&& tokenInformations[next].GetToken() == Token::LINE_COMMENT)
+		{
+			++next;
+		}
+		if (next < tokenInformations.size() && tokenInformations[next].GetTokenStreamString().position.GetLine() > line)
+		{
+			tokenStarts.emplace_back(next);
+			lineStarts.emplace_back(regionFirstLine + static_cast<size_t>(line - lexerFirstLine) + 1);
+		}
+	}
+	tokenStarts.emplace_back(tokenInformations.size());
+	lineStarts.emplace_back(regionEndLine);
+	for (size_t i = 0; i + 1 < tokenStarts.size(); ++i)
+	{
+		std::unique_ptr<IncrementalStatement> statement = std::make_unique<IncrementalStatement>();
+		statement->firstLine = lineStarts[i];
+		statement->lineCount = lineStarts[i + 1] - lineStarts[i];
+		statement->lexerFirstLine = lexerFirstLine + static_cast<long>(lineStarts[i] - regionFirstLine);
+		statement->tokenInformations.assign(
+			std::make_move_iterator(tokenInformations.begin() + tokenStarts[i]),
+			std::make_move_iterator(tokenInformations.begin() + tokenStarts[i + 1]));
+		for (TokenInformation const & tokenInformation : statement->tokenInformations)
+		{
+			if (TokenExtensions::ToString(tokenInformation.GetToken()) == TokenConstant::Name::IDENTIFIER)
+			{
+				statement->identifiers.emplace(tokenInformation.GetTokenStreamString().string);
+			}
+		}
+		statements.emplace_back(std::move(statement));
+	}
+}
+
+bool IncrementalCompiler::IsStatementBoundary(
+	std::vector<TokenInformation> const & lhs,
+	std::vector<TokenInformation> const & rhs
+) const
+{
+	size_t end = lhs.size();
+	while (end > 0 && IsComment(lhs[end - 1]))
+	{
+		--end;
+	}
+	if (end == 0)
+	{
+		return false;
+	}
+	std::vector<TokenInformation> tokenInformations;
+	tokenInformations.reserve(lhs.size() + rhs.size() + 1);
+	tokenInformations.insert(tokenInformations.end(), lhs.begin(), lhs.end());
+	tokenInformations.insert(tokenInformations.end(), rhs.begin(), rhs.end());
+	tokenInformations.emplace_back(m_endTokenInformation);
+	std::vector<size_t> boundaries;
+	m_syntaxValidator.FindStatementBoundaries(tokenInformations, boundaries);
+
+	return std::find(boundaries.begin(), boundaries.end(), end) != boundaries.end();
+}
+
+void IncrementalCompiler::CompilePending(std::set<size_t> & pendingIndices, IncrementalResult & result)
+{
+	// Declarations only reach statements further down, so compiling in source order sees every change once
+	while (!pendingIndices.empty())
+	{
+		IncrementalStatement & statement = *m_statements[*pendingIndices.begin()];
+		pendingIndices.erase(pendingIndices.begin());
+		std::unordered_set<std::string> changedNames;
+		CompileStatement(statement, changedNames);
+		++result.compiledStatementCount;
+		if (!statement.isValid)
+		{
+			result.errorLines.emplace_back(statement.errorLine);
+		}
+		for (std::string const & name : changedNames)
+		{
+			AddDependents(name, statement.index + 1, pendingIndices);
+		}
+	}
+}
+
+void IncrementalCompiler::CompileStatement(IncrementalStatement & statement, std::unordered_set<std::string> & changedNames)
+{
+	DetachDeclarations(statement);
+	// A name declared further down is not declared yet here, so its global is hidden while this statement is compiled
+	std::vector<std::pair<std::string, unsigned int>> hiddenGlobals;
+	for (std::string const & identifier : statement.identifiers)
+	{
+		auto const & it = m_declaringStatements.find(identifier);
+		unsigned int rowIndex = 0;
+		if (it != m_declaringStatements.end() && it->second->index > statement.index
+			&& m_parser.DetachReplGlobal(identifier, rowIndex))
+		{
+			hiddenGlobals.emplace_back(identifier, rowIndex);
+		}
+	}
+	std::vector<TokenInformation> tokenInformations(statement.tokenInformations);
+	tokenInformations.emplace_back(m_endTokenInformation);
+	bool const wasValid = statement.isValid;
+	statement.module.reset();
+	statement.isValid = m_parser.CompileReplInput(tokenInformations, "statement_" + std::to_string(statement.id), statement.module);
+	std::unordered_map<std::string, std::string> declarations;
+	if (statement.isValid)
+	{
+		for (std::string const & name : m_parser.GetReplInputGlobalNames())
+		{
+			declarations.emplace(name, CreateSignature(name));
+			m_declaringStatements[name] = &statement;
+		}
+	}
+	else
+	{
+		size_t const failIndex = std::min(m_parser.GetParserState().failIndex, tokenInformations.size() - 1);
+		long const failLine = failIndex < statement.tokenInformations.size()
+			? tokenInformations[failIndex].GetTokenStreamString().position.GetLine()
+			: statement.lexerFirstLine + static_cast<long>(statement.lineCount) - 1;
+		statement.errorLine = statement.firstLine + static_cast<size_t>(std::max(failLine - statement.lexerFirstLine, 0L));
+	}
+	for (std::pair<std::string, unsigned int> const & hiddenGlobal : hiddenGlobals)
+	{
+		// The declaration further down lost its name to this statement and fails when it is compiled again
+		if (declarations.find(hiddenGlobal.first) == declarations.end())
+		{
+			m_parser.AttachReplGlobal(hiddenGlobal.first, hiddenGlobal.second);
+		}
+	}
+	for (std::pair<std::string const, std::string> const & declaration : statement.declarations)
+	{
+		auto const & it = declarations.find(declaration.first);
+		if (it == declarations.end() || it->second != declaration.second)
+		{
+			changedNames.emplace(declaration.first);
+		}
+	}
+	for (std::pair<std::string const, std::string> const & declaration : declarations)
+	{
+		if (statement.declarations.find(declaration.first) == statement.declarations.end())
+		{
+			changedNames.emplace(declaration.first);
+		}
+	}
+	statement.declarations = std::move(declarations);
+	if (wasValid && !statement.isValid)
+	{
+		++m_invalidStatementCount;
+	}
+	else if (!wasValid && statement.isValid)
+	{
+		--m_invalidStatementCount;
+	}
+}
+
+void IncrementalCompiler::DetachDeclarations(IncrementalStatement const & statement)
+{
+	for (std::pair<std::string const, std::string> const & declaration : statement.declarations)
+	{
+		auto const & it = m_declaringStatements.find(declaration.first);
+		unsigned int rowIndex = 0;
+		if (it != m_declaringStatements.end() && it->second == &statement)
+		{
+			m_parser.DetachReplGlobal(declaration.first, rowIndex);
+			m_declaringStatements.erase(it);
+		}
+	}
+}
+
+void IncrementalCompiler::AddDependents(std::string const & name, size_t firstIndex, std::set<size_t> & pendingIndices) const
+{
+	auto const & it = m_referencingStatements.find(name);
+	if (it == m_referencingStatements.end())
+	{
+		return;
+	}
+	for (IncrementalStatement * statement : it->second)
+	{
+		if (statement->index >= firstIndex)
+		{
+			pendingIndices.emplace(statement->index);
+		}
+	}
+}
+
+void IncrementalCompiler::AddReferences(IncrementalStatement * statement)
+{
+	for (std::string const & identifier : statement->identifiers)
+	{
+		m_referencingStatements[identifier].emplace(statement);
+	}
+}
+
+void IncrementalCompiler::RemoveReferences(IncrementalStatement * statement)
+{
+	for (std::string const & identifier : statement->identifiers)
+	{
+		auto const & it = m_referencingStatements.find(identifier);
+		if (it == m_referencingStatements.end())
+		{
+			continue;
+		}
+		it->second.erase(statement);
+		if (it->second.empty())
+		{
+			m_referencingStatements.erase(it);
+		}
+	}
+}
+
+std::string IncrementalCompiler::CreateSignature(std::string const & name) const
+{
+	SymbolTableRow symbolTableRow;
+	if (!m_parser.GetReplGlobal(name, symbolTableRow))
+	{
+		return "";
+	}
+	std::string signature = symbolTableRow.type;
+	if (symbolTableRow.arrayInformation != nullptr)
+	{
+		for (unsigned int dimension : symbolTableRow.arrayInformation->dimensions)
+		{
+			signature += "[" + std::to_string(dimension) + "]";
+		}
+	}
+	return signature + " " + symbolTableRow.globalName;
+}
+
+size_t IncrementalCompiler::FindStatementIndex(size_t line) const
+{
+	auto const & it = std::upper_bound(
+		m_statements.begin(),
+		m_statements.end(),
+		line,
+		[](size_t line, std::unique_ptr<IncrementalStatement> const & statement)
+		{
+			return line < statement->firstLine;
+		}
+	);
+	return it == m_statements.begin() ? 0 : static_cast<size_t>(it - m_statements.begin()) - 1;
+}
+
+bool IncrementalCompiler::ReadTokenInformations(size_t firstLine, size_t endLine, std::vector<TokenInformation> & tokenInformations)
+{
+	if (m_regionFileName.empty())
+	{
+		return false;
+	}
+	{
+		std::ofstream regionFile(m_regionFileName, std::ios::trunc);
+		for (size_t i = firstLine; i < endLine; ++i)
+		{
+			regionFile << m_lines[i] << "\n";
+		}
+		if (!regionFile)
+		{
+			return false;
+		}
+	}
+	Lexer lexer(m_regionFileName);
+	TokenInformation tokenInformation;
+	while (lexer.GetNextTokenInformation(tokenInformation))
+	{
+		tokenInformations.emplace_back(std::move(tokenInformation));
+	}
+	if (!tokenInformations.empty())
+	{
+		// Every input ends with the same terminating token, which each statement borrows when it is compiled
+		m_endTokenInformation = tokenInformations.back();
+		tokenInformations.pop_back();
+	}
+	return true;
+}
+
+void IncrementalCompiler::SplitLines(std::string const & text, std::vector<std::string> & lines)
+{
+	std::istringstream textStream(text);
+	std::string line;
+	while (std::getline(textStream, line))
+	{
+		lines.emplace_back(line);
+	}
+}
+
+bool IncrementalCompiler::IsComment(TokenInformation const & tokenInformation)
+{
+	return tokenInformation.GetToken() == Token::LINE_COMMENT || tokenInformation.GetToken() == Token::BLOCK_COMMENT;
+}
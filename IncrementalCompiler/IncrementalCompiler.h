@@ -0,0 +1,68 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_INCREMENTALCOMPILER_H
+#define LLPARSERLIBRARYEXAMPLE_INCREMENTALCOMPILER_H
+
+#include "../LLParser.h"
+#include "IncrementalResult/IncrementalResult.h"
+#include "IncrementalStatement/IncrementalStatement.h"
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <llvm/Support/raw_ostream.h>
+
+// Recompiles a source that is edited repeatedly. The source is split into groups of top-level statements at line
+// boundaries, and every group is lowered into its own function and module the way REPL inputs are, so top-level
+// variables become globals that other groups reach through external declarations.
+// An edit re-lexes, re-parses and re-lowers only the groups whose lines it touches. A later group is compiled again
+// only when a top-level declaration it names appeared, disappeared or changed, so the cost follows the edit and
+// what depends on it rather than the size of the source.
+class IncrementalCompiler
+{
+public:
+	explicit IncrementalCompiler(std::string const & ruleFileName);
+	~IncrementalCompiler();
+
+	void SetCompileOptions(CompileOptions const & compileOptions);
+	bool Open(std::string const & inputFileName, IncrementalResult & result);
+	bool Edit(size_t firstLine, size_t lastLine, std::string const & text, IncrementalResult & result);
+	void PrintIr(llvm::raw_ostream & output) const;
+
+private:
+	void Clear();
+	bool Rebuild(size_t from, size_t to, size_t regionFirstLine, size_t regionEndLine, IncrementalResult & result);
+	void SplitStatements(
+		std::vector<TokenInformation> & tokenInformations,
+		size_t regionFirstLine,
+		size_t regionEndLine,
+		std::vector<std::unique_ptr<IncrementalStatement>> & statements
+	) const;
+	bool IsStatementBoundary(std::vector<TokenInformation> const & lhs, std::vector<TokenInformation> const & rhs) const;
+	void CompilePending(std::set<size_t> & pendingIndices, IncrementalResult & result);
+	void CompileStatement(IncrementalStatement & statement, std::unordered_set<std::string> & changedNames);
+	void DetachDeclarations(IncrementalStatement const & statement);
+	void AddDependents(std::string const & name, size_t firstIndex, std::set<size_t> & pendingIndices) const;
+	void AddReferences(IncrementalStatement * statement);
+	void RemoveReferences(IncrementalStatement * statement);
+	std::string CreateSignature(std::string const & name) const;
+	size_t FindStatementIndex(size_t line) const;
+	bool ReadTokenInformations(size_t firstLine, size_t endLine, std::vector<TokenInformation> & tokenInformations);
+	static void SplitLines(std::string const & text, std::vector<std::string> & lines);
+	static bool IsComment(TokenInformation const & tokenInformation);
+
+	std::shared_ptr<LLTableBuilder> m_llTableBuilder;
+	LLParser m_parser;
+	SyntaxValidator m_syntaxValidator;
+	CompileOptions m_compileOptions;
+	std::string m_regionFileName;
+	std::vector<std::string> m_lines;
+	TokenInformation m_endTokenInformation;
+	std::vector<std::unique_ptr<IncrementalStatement>> m_statements;
+	std::unordered_map<std::string, IncrementalStatement*> m_declaringStatements;
+	std::unordered_map<std::string, std::unordered_set<IncrementalStatement*>> m_referencingStatements;
+	size_t m_invalidStatementCount = 0;
+	unsigned int m_nextStatementId = 0;
+};
+
+#endif
@@ -0,0 +1 @@
+#include "IncrementalResult.h"
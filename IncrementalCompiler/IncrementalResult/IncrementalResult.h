@@ -0,0 +1,21 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_INCREMENTALRESULT_H
+#define LLPARSERLIBRARYEXAMPLE_INCREMENTALRESULT_H
+
+#include <cstddef>
+#include <vector>
+
+// Lines are counted from 0. Error lines cover the statements compiled by this update only;
+// the errors of every other statement are the ones reported when it was last compiled.
+class IncrementalResult
+{
+public:
+	bool isValid = false;
+	size_t firstChangedLine = 0;
+	size_t changedLineCount = 0;
+	size_t relexedLineCount = 0;
+	size_t compiledStatementCount = 0;
+	size_t statementCount = 0;
+	std::vector<size_t> errorLines;
+};
+
+#endif
@@ -0,0 +1 @@
+#include "IncrementalStatement.h"
@@ -0,0 +1,32 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_INCREMENTALSTATEMENT_H
+#define LLPARSERLIBRARYEXAMPLE_INCREMENTALSTATEMENT_H
+
+#include "../../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <llvm/IR/Module.h>
+
+// One or more top-level statements that share no line with their neighbours, lowered into their own module.
+// Token lines are the lexer's, so the line of a token is firstLine + its line - lexerFirstLine.
+// Declarations map every top-level name the statements declared to its type, dimensions and global name.
+class IncrementalStatement
+{
+public:
+	unsigned int id = 0;
+	size_t index = 0;
+	size_t firstLine = 0;
+	size_t lineCount = 0;
+	long lexerFirstLine = 0;
+	std::vector<TokenInformation> tokenInformations;
+	std::unordered_set<std::string> identifiers;
+	std::unordered_map<std::string, std::string> declarations;
+	std::unique_ptr<llvm::Module> module;
+	bool isValid = false;
+	size_t errorLine = 0;
+};
+
+#endif
@@ -4,42 +4,153 @@
 #include "LLTableBuilderLibrary/TokenLibrary/TokenExtensions/TokenExtensions.h"
 #include "LexerLibrary/Lexer.h"
 #include "LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include "PipelinedLexer/PipelinedLexer.h"
+#include "ProgramOutput/ProgramOutput.h"
 #include "Calculator/Calculator.h"
+#include "ExpressionSimplifier/ExpressionSimplifier.h"
 #include "LlvmHelper/LlvmHelper.h"
 #include <string>
 #include <functional>
 #include <regex>
 #include <unordered_set>
 #include <numeric>
+#include <chrono>
+#include <limits>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/DataLayout.h>
-#include <llvm/IR/LegacyPassManager.h>
-#include <llvm/ExecutionEngine/ExecutionEngine.h>
-#include <llvm/ExecutionEngine/GenericValue.h>
-#include <llvm/ExecutionEngine/Interpreter.h>
-#include <llvm/Support/TargetSelect.h>
-#include <llvm/Support/TargetRegistry.h>
+#include <llvm/Analysis/ValueTracking.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/Support/Error.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/Host.h>
-#include <llvm/Target/TargetMachine.h>
-#include <llvm/Target/TargetOptions.h>
 #include <llvm/Transforms/Utils/BasicBlockUtils.h>
+#include <llvm/Transforms/Utils/Local.h>
+#include <llvm/Transforms/Utils/Cloning.h>
 
 LLParser::LLParser(std::string const & ruleFileName)
-	: m_llTableBuilder(ruleFileName)
+	: LLParser(std::make_shared<LLTableBuilder>(ruleFileName))
+{
+}
+
+LLParser::LLParser(std::shared_ptr<LLTableBuilder> llTableBuilder)
+	: m_llTableBuilder(std::move(llTableBuilder))
+{
+	m_builder = new llvm::IRBuilder(*m_context);
+	CreateModule("Main", "main");
+}
+
+void LLParser::Reset()
+{
+	m_parserState.Reset();
+	m_ast.clear();
+	m_usedAstNodeCount = 0;
+	m_scopes.resize(1);
+	m_scopes.front().clear();
+	m_symbolTable.Clear();
+	m_preWhileBlocks = std::stack<llvm::BasicBlock*>();
+	m_whileBlocks = std::stack<llvm::BasicBlock*>();
+	m_blocksTrue = std::stack<llvm::BasicBlock*>();
+	m_blocksFalse = std::stack<llvm::BasicBlock*>();
+	m_previousBlocks = std::stack<llvm::BasicBlock*>();
+	m_compileResult = CompileResult();
+	m_cacheKey.clear();
+	m_isReplMode = false;
+	// Types and constants stay uniqued in a context for as long as it lives, so each program gets a fresh one
+	// and a parser that compiles many programs does not keep all of their constants
+	m_module.reset();
+	m_threadSafeContext = llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
+	m_context = m_threadSafeContext.getContext();
+	delete m_builder;
+	m_builder = new llvm::IRBuilder(*m_context);
+	CreateModule("Main", "main");
+}
+
+bool LLParser::CompileReplInput(
+	std::vector<TokenInformation> const & tokenInformations,
+	std::string const & functionName,
+	std::unique_ptr<llvm::Module> & module
+)
 {
-	m_module = std::make_unique<llvm::Module>("Main", m_context);
-	m_dataLayout = std::make_unique<llvm::DataLayout>(m_module.get());
-	std::vector<llvm::Type *> mainFunctionArgumentsTypes;
-	m_mainFunctionType = llvm::FunctionType::get(llvm::Type::getInt32Ty(m_context), mainFunctionArgumentsTypes, false);
-	m_mainFunction = llvm::Function::Create(m_mainFunctionType, llvm::GlobalValue::ExternalLinkage, "main", m_module.get());
-	m_mainBlock = llvm::BasicBlock::Create(m_context, "main block", m_mainFunction, nullptr);
-	m_builder = new llvm::IRBuilder(m_context);
-	m_builder->SetInsertPoint(m_mainBlock);
-	m_previousBlocks.push(m_mainBlock);
+	m_replInputGlobalNames.clear();
+	m_replInputSymbolTableSize = m_symbolTable.GetSize();
+	m_isReplMode = true;
+	m_parserState.Reset();
+	m_ast.clear();
+	m_usedAstNodeCount = 0;
+	m_preWhileBlocks = std::stack<llvm::BasicBlock*>();
+	m_whileBlocks = std::stack<llvm::BasicBlock*>();
+	m_blocksTrue = std::stack<llvm::BasicBlock*>();
+	m_blocksFalse = std::stack<llvm::BasicBlock*>();
+	m_previousBlocks = std::stack<llvm::BasicBlock*>();
+	m_compileResult = CompileResult();
+	CreateModule(functionName, functionName);
+	Feed(tokenInformations);
+	if (!Finish())
+	{
+		RollBackReplInput();
+
+		return false;
+	}
+	module = std::move(m_module);
+
+	return true;
+}
+
+void LLParser::RollBackReplInput()
+{
+	// Only top-level declarations outlive an input, so undoing them costs as much as the input, not the session
+	m_scopes.resize(1);
+	for (std::string const & name : m_replInputGlobalNames)
+	{
+		m_scopes.front().erase(name);
+	}
+	m_replInputGlobalNames.clear();
+	m_symbolTable.Truncate(m_replInputSymbolTableSize);
+}
+
+std::vector<std::string> const & LLParser::GetReplInputGlobalNames() const
+{
+	return m_replInputGlobalNames;
+}
+
+bool LLParser::GetReplGlobal(std::string const & name, SymbolTableRow & result) const
+{
+	auto const & it = m_scopes.front().find(name);
+
+	return it != m_scopes.front().end() && m_symbolTable.GetSymbolTableRowByRowIndex(it->second, result);
+}
+
+bool LLParser::DetachReplGlobal(std::string const & name, unsigned int & rowIndex)
+{
+	auto const & it = m_scopes.front().find(name);
+	if (it == m_scopes.front().end())
+	{
+		return false;
+	}
+	rowIndex = it->second;
+	m_scopes.front().erase(it);
+
+	return true;
+}
+
+void LLParser::AttachReplGlobal(std::string const & name, unsigned int rowIndex)
+{
+	m_scopes.front()[name] = rowIndex;
+}
+
+llvm::orc::ThreadSafeContext const & LLParser::GetThreadSafeContext() const
+{
+	return m_threadSafeContext;
+}
+
+void LLParser::SetCompileOptions(CompileOptions const & compileOptions)
+{
+	m_compileOptions = compileOptions;
 }
 
 bool LLParser::IsValid(
@@ -49,214 +160,514 @@ bool LLParser::IsValid(
 	std::unordered_set<Token> & expectedTokens
 )
 {
-	bool result;
-	Lexer lexer(inputFileName);
-	Table const & table = m_llTableBuilder.GetTable();
-	std::stack<unsigned int> stack;
-	size_t inputWordIndex = 0;
-	unsigned int currentRowId = 1;
+	std::function<bool(TokenInformation &)> getNextTokenInformation = CreateTokenSource(inputFileName);
+	StartParsing();
 	TokenInformation tokenInformation;
-	bool newToken = true;
-	if (!lexer.GetNextTokenInformation(tokenInformation))
+	while (getNextTokenInformation(tokenInformation))
 	{
-		return false;
+		Feed(tokenInformation);
 	}
-	tokenInformations.emplace_back(tokenInformation);
-	while (true)
+	bool result = Finish();
+	tokenInformations.insert(
+		tokenInformations.end(),
+		std::make_move_iterator(m_parserState.tokenInformations.begin()),
+		std::make_move_iterator(m_parserState.tokenInformations.end()));
+	m_parserState.tokenInformations.clear();
+	if (!result)
 	{
-		Token currentToken = tokenInformation.GetToken();
-		TableRow * currentRow = table.GetRow(currentRowId);
-		if (currentRow == nullptr)
+		failIndex = m_parserState.failIndex;
+		expectedTokens.insert(m_parserState.expectedTokens.begin(), m_parserState.expectedTokens.end());
+	}
+	return result;
+}
+
+bool LLParser::ValidateSyntax(
+	std::string const & inputFileName,
+	std::vector<TokenInformation> & tokenInformations,
+	std::vector<SyntaxError> & syntaxErrors
+)
+{
+	std::function<bool(TokenInformation &)> getNextTokenInformation = CreateTokenSource(inputFileName);
+	std::vector<TokenInformation> inputTokenInformations;
+	TokenInformation tokenInformation;
+	while (getNextTokenInformation(tokenInformation))
+	{
+		inputTokenInformations.emplace_back(std::move(tokenInformation));
+	}
+	if (m_threadPool == nullptr)
+	{
+		m_threadPool = std::make_unique<ThreadPool>(std::thread::hardware_concurrency());
+	}
+	SyntaxValidator syntaxValidator(m_llTableBuilder->GetTable());
+	bool result = syntaxValidator.ValidateInParallel(inputTokenInformations, *m_threadPool, syntaxErrors);
+	tokenInformations.insert(
+		tokenInformations.end(),
+		std::make_move_iterator(inputTokenInformations.begin()),
+		std::make_move_iterator(inputTokenInformations.end()));
+
+	return result;
+}
+
+void LLParser::StartParsing()
+{
+	m_parserState.Reset();
+}
+
+ParseStatus LLParser::Feed(TokenInformation const & tokenInformation)
+{
+	m_parserState.tokenInformations.emplace_back(tokenInformation);
+	if (m_parserState.status != ParseStatus::NEED_TOKEN)
+	{
+		return m_parserState.status;
+	}
+	if (m_parserState.tokenInformations.size() > 1)
+	{
+		++m_parserState.inputWordIndex;
+	}
+	m_parserState.status = Advance();
+
+	return m_parserState.status;
+}
+
+ParseStatus LLParser::Feed(std::vector<TokenInformation> const & tokenInformations)
+{
+	for (TokenInformation const & tokenInformation : tokenInformations)
+	{
+		Feed(tokenInformation);
+	}
+	return m_parserState.status;
+}
+
+bool LLParser::Finish()
+{
+	if (m_parserState.status == ParseStatus::NEED_TOKEN)
+	{
+		m_parserState.failIndex = m_parserState.inputWordIndex;
+		m_parserState.status = ParseStatus::REJECTED;
+		m_parserState.isInputExhausted = true;
+	}
+	bool result = m_parserState.status == ParseStatus::ACCEPTED;
+	if (result)
+	{
+		CompleteCompilation();
+	}
+	return result;
+}
+
+ParserState const & LLParser::GetParserState() const
+{
+	return m_parserState;
+}
+
+ParseStatus LLParser::Advance()
+{
+	Table const & table = m_llTableBuilder->GetTable();
+	TokenInformation const & tokenInformation = m_parserState.tokenInformations.back();
+	Token const currentToken = tokenInformation.GetToken();
+	if (m_parserState.isShiftPending)
+	{
+		m_parserState.isShiftPending = false;
+		if (!GotoNextRow(table.GetRow(m_parserState.currentRowId)))
 		{
-			result = false;
-			break;
+			return ParseStatus::REJECTED;
 		}
-		if (newToken)
+	}
+	while (true)
+	{
+		TableRow * currentRow = table.GetRow(m_parserState.currentRowId);
+		if (currentRow == nullptr)
 		{
-			newToken = false;
+			m_parserState.failIndex = m_parserState.inputWordIndex;
+
+			return ParseStatus::REJECTED;
 		}
-		if (!ResolveActionName(currentRow->actionName))
+		if (m_compileOptions.runSemanticAnalysis && !ResolveActionName(currentRow->actionName))
 		{
-			failIndex = inputWordIndex;
-			result = false;
-			break;
+			m_parserState.failIndex = m_parserState.inputWordIndex;
+
+			return ParseStatus::REJECTED;
 		}
 		if (currentToken == Token::LINE_COMMENT || currentToken == Token::BLOCK_COMMENT)
 		{
-			if (!lexer.GetNextTokenInformation(tokenInformation))
-			{
-				result = false;
-				break;
-			}
-			tokenInformations.emplace_back(tokenInformation);
-			++inputWordIndex;
-			continue;
+			return ParseStatus::NEED_TOKEN;
 		}
 		if (currentRow->referencingSet.find(currentToken) != currentRow->referencingSet.end() || !currentRow->actionName.empty())
 		{
-			if (currentRow->isEnd && stack.empty())
+			if (currentRow->isEnd && m_parserState.stack.empty())
 			{
-				m_ast.emplace_back(new AstNode());
-				m_ast.back()->name = TokenExtensions::ToString(currentToken);
-				m_ast.back()->type = m_ast.back()->name;
-				m_ast.back()->computedType = m_ast.back()->name;
-				m_ast.back()->stringValue = tokenInformation.GetTokenStreamString().string;
+				if (!m_compileOptions.runSemanticAnalysis)
+				{
+					return ParseStatus::ACCEPTED;
+				}
+				PushTokenAstNode(tokenInformation);
 				if (!ResolveAstActionName(currentRow->actionName))
 				{
-					failIndex = inputWordIndex;
-					result = false;
-					break;
+					m_parserState.failIndex = m_parserState.inputWordIndex;
+
+					return ParseStatus::REJECTED;
 				}
-				result = true;
-				break;
+				return ParseStatus::ACCEPTED;
 			}
 			if (currentRow->doShift)
 			{
-				m_ast.emplace_back(new AstNode());
-				m_ast.back()->name = TokenExtensions::ToString(currentToken);
-				m_ast.back()->type = m_ast.back()->name;
-				m_ast.back()->computedType = m_ast.back()->name;
-				m_ast.back()->stringValue = tokenInformation.GetTokenStreamString().string;
-				if (!lexer.GetNextTokenInformation(tokenInformation))
+				if (m_compileOptions.runSemanticAnalysis)
 				{
-					result = false;
-					break;
+					PushTokenAstNode(tokenInformation);
 				}
-				tokenInformations.emplace_back(tokenInformation);
-				++inputWordIndex;
-				newToken = true;
-			}
-			else if (currentRow->pushToStack != 0)
-			{
-				stack.push(currentRow->pushToStack);
+				m_parserState.isShiftPending = true;
+
+				return ParseStatus::NEED_TOKEN;
 			}
-			if (currentRow->nextId != 0)
+			if (currentRow->pushToStack != 0)
 			{
-				currentRowId = currentRow->nextId;
+				m_parserState.stack.push(currentRow->pushToStack);
 			}
-			else
+			if (!GotoNextRow(currentRow))
 			{
-				if (stack.empty())
-				{
-					result = false;
-					break;
-				}
-				currentRowId = stack.top();
-				stack.pop();
-				if (!ResolveAstActionName(currentRow->actionName))
-				{
-					failIndex = inputWordIndex;
-					result = false;
-					break;
-				}
+				return ParseStatus::REJECTED;
 			}
 		}
 		else if (currentRow->isError)
 		{
-			failIndex = inputWordIndex;
-			expectedTokens.insert(
-				std::make_move_iterator(currentRow->referencingSet.begin()),
-				std::make_move_iterator(currentRow->referencingSet.end()));
-			--currentRowId;
-			currentRow = table.GetRow(currentRowId);
-			while (currentRow != nullptr && !currentRow->isError)
+			m_parserState.failIndex = m_parserState.inputWordIndex;
+			unsigned int errorRowId = m_parserState.currentRowId;
+			while (currentRow != nullptr && (errorRowId == m_parserState.currentRowId || !currentRow->isError))
 			{
-				expectedTokens.insert(
-					std::make_move_iterator(currentRow->referencingSet.begin()),
-					std::make_move_iterator(currentRow->referencingSet.end()));
-				--currentRowId;
-				currentRow = table.GetRow(currentRowId);
+				m_parserState.expectedTokens.insert(currentRow->referencingSet.begin(), currentRow->referencingSet.end());
+				--errorRowId;
+				currentRow = table.GetRow(errorRowId);
 			}
-			result = false;
-			break;
+			return ParseStatus::REJECTED;
 		}
 		else
 		{
-			++currentRowId;
+			++m_parserState.currentRowId;
 		}
 	}
-	while (lexer.GetNextTokenInformation(tokenInformation))
+}
+
+bool LLParser::GotoNextRow(TableRow const * currentRow)
+{
+	if (currentRow->nextId != 0)
 	{
-		tokenInformations.emplace_back(std::move(tokenInformation));
+		m_parserState.currentRowId = currentRow->nextId;
+
+		return true;
 	}
-	if (result)
+	if (m_parserState.stack.empty())
 	{
-		m_builder->CreateRet(LlvmHelper::CreateInteger32Constant(m_context, 0));
+		m_parserState.failIndex = m_parserState.inputWordIndex;
 
-		std::cout << "\033[1;30;42m" << "--------------- Recode ---------------" << "\033[0m" << std::endl;
-		PrintTokenInformations(tokenInformations, 0, tokenInformations.size(), "32");
-		std::cout << "\n";
-		std::cout << "\033[1;30;42m" << "--------------------------------------" << "\033[0m" << std::endl;
-		std::cout << "         ⬇         ⬇         ⬇        " << std::endl;
+		return false;
+	}
+	m_parserState.currentRowId = m_parserState.stack.top();
+	m_parserState.stack.pop();
+	if (m_compileOptions.runSemanticAnalysis && !ResolveAstActionName(currentRow->actionName))
+	{
+		m_parserState.failIndex = m_parserState.inputWordIndex;
 
-		std::cout << "\033[1;30;44m" << "------------ LLVM-IR Code ------------" << "\033[0m" << std::endl;
-		llvm::outs() << "\033[34m";
-		m_module->print(llvm::outs(), nullptr);
-		std::cout << "\033[1;30;44m" << "--------------------------------------" << "\033[0m" << std::endl;
-		std::cout << "         ⬇         ⬇         ⬇        " << std::endl;
+		return false;
+	}
+	return true;
+}
 
-		std::string errStr;
-		llvm::ExecutionEngine * engine = llvm::EngineBuilder(std::make_unique<llvm::Module>("Main", m_context)).setErrorStr(&errStr).create();
-		engine->finalizeObject();
-		std::cout << "\033[1;30;47m" << "-------- Executed LLVM-IR Code -------" << "\033[0m" << std::endl;
-		std::cout << "\033[37m";
-		engine->runFunction(m_mainFunction, std::vector<llvm::GenericValue>());
-		std::cout << "\033[1;30;47m" << "--------------------------------------" << "\033[0m" << std::endl;
+void LLParser::PushTokenAstNode(TokenInformation const & tokenInformation)
+{
+	m_ast.emplace_back(AllocateAstNode());
+	m_ast.back()->name = TokenExtensions::ToString(tokenInformation.GetToken());
+	m_ast.back()->type = m_ast.back()->name;
+	m_ast.back()->computedType = m_ast.back()->name;
+	m_ast.back()->stringValue = tokenInformation.GetTokenStreamString().string;
+}
 
-		llvm::InitializeAllTargetInfos();
-		llvm::InitializeAllTargets();
-		llvm::InitializeAllTargetMCs();
-		llvm::InitializeAllAsmParsers();
-		llvm::InitializeAllAsmPrinters();
+std::function<bool(TokenInformation &)> LLParser::CreateTokenSource(std::string const & inputFileName) const
+{
+	if (m_compileOptions.pipelinedLexing)
+	{
+		std::shared_ptr<PipelinedLexer> pipelinedLexer = std::make_shared<PipelinedLexer>(inputFileName);
 
-		std::string targetTriple = llvm::sys::getDefaultTargetTriple();
-		m_module->setTargetTriple(targetTriple);
+		return [pipelinedLexer](TokenInformation & tokenInformation)
+		{
+			return pipelinedLexer->GetNextTokenInformation(tokenInformation);
+		};
+	}
+	std::shared_ptr<Lexer> lexer = std::make_shared<Lexer>(inputFileName);
 
-		std::string error;
-		auto target = llvm::TargetRegistry::lookupTarget(targetTriple, error);
+	return [lexer](TokenInformation & tokenInformation)
+	{
+		return lexer->GetNextTokenInformation(tokenInformation);
+	};
+}
 
-		if (!target)
+void LLParser::CompleteCompilation()
+{
+	if (m_compileOptions.recodeOutput != nullptr)
+	{
+		PrintRecode(*m_compileOptions.recodeOutput);
+	}
+	if (!m_compileOptions.runSemanticAnalysis)
+	{
+		return;
+	}
+	m_builder->CreateRet(LlvmHelper::CreateInteger32Constant(*m_context, 0));
+	m_compileResult.deduplicatedConstantCount = m_constantPool.GetDeduplicatedCount();
+	llvm::removeUnreachableBlocks(*m_mainFunction);
+	if (m_compileCache != nullptr)
+	{
+		m_cacheKey = m_compileCache->CreateKey(m_parserState.tokenInformations, m_compileOptions);
+		m_module->setModuleIdentifier(m_cacheKey);
+		m_compileResult.isCacheHit = LoadCachedModule();
+	}
+	if (!m_compileResult.isCacheHit && m_compileOptions.optimizationLevel != OptimizationLevel::O0 && PrepareCompilerSession())
+	{
+		std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
+		m_compilerSession->Optimize(*m_module, m_compileOptions.optimizationLevel, m_compileResult.passTimings);
+		m_compileResult.optimizationTime = std::chrono::steady_clock::now() - startTime;
+	}
+	if (m_compileCache != nullptr && !m_compileResult.isCacheHit)
+	{
+		std::unique_ptr<llvm::MemoryBuffer> bitcode;
+		if (Emit(EmissionKind::BITCODE, bitcode))
 		{
-			std::cout << "Target: " + error;
+			m_compileCache->Store(m_cacheKey, CompileCache::BITCODE_EXTENSION, bitcode->getBuffer());
 		}
-		else
-		{
-			llvm::TargetOptions opt;
-			llvm::Optional<llvm::Reloc::Model> relocationModel = llvm::Optional<llvm::Reloc::Model>(llvm::Reloc::Model::PIC_);
-			llvm::TargetMachine * targetMachine = target->createTargetMachine(targetTriple, "generic", "", opt, relocationModel);
+	}
+	if (m_compileOptions.irOutput != nullptr)
+	{
+		PrintIr(*m_compileOptions.irOutput);
+	}
+	if (m_compileOptions.emitObject)
+	{
+		EmitObjectFile(m_compileOptions.objectFileName);
+	}
+	if (m_compileOptions.execute)
+	{
+		int exitCode;
+		Execute(exitCode);
+	}
+}
 
-			m_module->setDataLayout(targetMachine->createDataLayout());
+void LLParser::PrintRecode(std::ostream & output) const
+{
+	std::vector<TokenInformation> const & tokenInformations = m_parserState.tokenInformations;
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[1;30;42m" << "--------------- Recode ---------------" << "\033[0m" << std::endl;
+	}
+	PrintTokenInformations(output, tokenInformations, 0, tokenInformations.size(), "32");
+	output << "\n";
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[1;30;42m" << "--------------------------------------" << "\033[0m" << std::endl;
+		output << "         ⬇         ⬇         ⬇        " << std::endl;
+	}
+}
 
-			std::error_code errorCode;
-			llvm::raw_fd_ostream output("output.o", errorCode, llvm::sys::fs::F_None);
+void LLParser::PrintIr(llvm::raw_ostream & output) const
+{
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[1;30;44m" << "------------ LLVM-IR Code ------------" << "\033[0m" << "\n";
+		output << "\033[34m";
+	}
+	m_module->print(output, nullptr);
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[1;30;44m" << "--------------------------------------" << "\033[0m" << "\n";
+		output << "         ⬇         ⬇         ⬇        " << "\n";
+	}
+	output.flush();
+}
 
-			if (errorCode)
-			{
-				std::cout << "Could not open file: " << errorCode.message();
-			}
-			else
+bool LLParser::Execute(int & exitCode)
+{
+	if (m_module == nullptr || !PrepareCompilerSession())
+	{
+		return false;
+	}
+	std::chrono::steady_clock::time_point const compileStartTime = std::chrono::steady_clock::now();
+	std::unique_ptr<llvm::orc::LLLazyJIT> jit;
+	std::string errorMessage;
+	if (!m_compilerSession->CreateJit(m_compileCache.get(), jit, errorMessage))
+	{
+		PrintErrorMessage(errorMessage);
+
+		return false;
+	}
+	// The JIT gets its own copy, so the module can still be emitted afterwards.
+	// The module is added eagerly and main is its only function, so the lookup below compiles all of it
+	// and jitCompileTime covers code generation instead of leaving it to the first call.
+	std::unique_ptr<llvm::Module> jitModule = llvm::CloneModule(*m_module);
+	jitModule->setDataLayout(jit->getDataLayout());
+	llvm::orc::ThreadSafeModule threadSafeModule(std::move(jitModule), m_threadSafeContext);
+	if (llvm::Error error = jit->addIRModule(std::move(threadSafeModule)))
+	{
+		PrintErrorMessage("JIT: " + llvm::toString(std::move(error)) + "\n");
+
+		return false;
+	}
+	llvm::Expected<llvm::JITEvaluatedSymbol> mainSymbol = jit->lookup("main");
+	if (!mainSymbol)
+	{
+		PrintErrorMessage("JIT: " + llvm::toString(mainSymbol.takeError()) + "\n");
+
+		return false;
+	}
+	m_compileResult.jitCompileTime = std::chrono::steady_clock::now() - compileStartTime;
+
+	std::ostream * executionOutput = m_compileOptions.executionOutput;
+	if (executionOutput != nullptr && m_compileOptions.decorateOutput)
+	{
+		*executionOutput << "\033[1;30;47m" << "-------- Executed LLVM-IR Code -------" << "\033[0m" << std::endl;
+		*executionOutput << "\033[37m";
+	}
+	auto main = reinterpret_cast<int (*)()>(static_cast<uintptr_t>(mainSymbol->getAddress()));
+	std::chrono::steady_clock::time_point const executionStartTime = std::chrono::steady_clock::now();
+	{
+		ProgramOutput programOutput(executionOutput);
+		exitCode = main();
+	}
+	m_compileResult.executionTime = std::chrono::steady_clock::now() - executionStartTime;
+	m_compileResult.exitCode = exitCode;
+	if (executionOutput != nullptr && m_compileOptions.decorateOutput)
+	{
+		*executionOutput << "\033[1;30;47m" << "--------------------------------------" << "\033[0m" << std::endl;
+	}
+	return true;
+}
+
+void LLParser::EmitObjectFile(std::string const & objectFileName)
+{
+	std::string errorMessage;
+	if (m_compileCache != nullptr)
+	{
+		std::unique_ptr<llvm::MemoryBuffer> object;
+		if (!m_compileCache->Load(m_cacheKey, CompileCache::OBJECT_EXTENSION, object))
+		{
+			if (!Emit(EmissionKind::OBJECT, object))
 			{
-				llvm::legacy::PassManager passManager;
-				if (targetMachine->addPassesToEmitFile(passManager, output, nullptr, llvm::TargetMachine::CGFT_ObjectFile))
-				{
-					std::cout << "TargetMachine can't emit a file of this type";
-				}
-				else
-				{
-					passManager.run(*m_module);
-					output.flush();
-				}
+				return;
 			}
+			m_compileCache->Store(m_cacheKey, CompileCache::OBJECT_EXTENSION, object->getBuffer());
+		}
+		std::error_code errorCode;
+		llvm::raw_fd_ostream output(objectFileName, errorCode, llvm::sys::fs::F_None);
+		if (errorCode)
+		{
+			PrintErrorMessage("Could not open file: " + errorCode.message() + "\n");
+
+			return;
 		}
+		output << object->getBuffer();
+
+		return;
 	}
-	return result;
+	if (PrepareCompilerSession() && !m_compilerSession->Emit(*m_module, EmissionKind::OBJECT, objectFileName, errorMessage))
+	{
+		PrintErrorMessage(errorMessage);
+	}
+}
+
+bool LLParser::Emit(EmissionKind emissionKind, llvm::raw_pwrite_stream & output)
+{
+	std::string errorMessage;
+	if (m_module == nullptr || !PrepareCompilerSession())
+	{
+		return false;
+	}
+	if (!m_compilerSession->Emit(*m_module, emissionKind, output, errorMessage))
+	{
+		PrintErrorMessage(errorMessage);
+
+		return false;
+	}
+	return true;
+}
+
+bool LLParser::Emit(EmissionKind emissionKind, std::unique_ptr<llvm::MemoryBuffer> & buffer)
+{
+	std::string errorMessage;
+	if (m_module == nullptr || !PrepareCompilerSession())
+	{
+		return false;
+	}
+	if (!m_compilerSession->Emit(*m_module, emissionKind, buffer, errorMessage))
+	{
+		PrintErrorMessage(errorMessage);
+
+		return false;
+	}
+	return true;
+}
+
+void LLParser::SetCompileCache(std::shared_ptr<CompileCache> compileCache)
+{
+	m_compileCache = std::move(compileCache);
+}
+
+bool LLParser::LoadCachedModule()
+{
+	std::unique_ptr<llvm::MemoryBuffer> bitcode;
+	if (!m_compileCache->Load(m_cacheKey, CompileCache::BITCODE_EXTENSION, bitcode))
+	{
+		return false;
+	}
+	llvm::Expected<std::unique_ptr<llvm::Module>> module = llvm::parseBitcodeFile(bitcode->getMemBufferRef(), *m_context);
+	if (!module)
+	{
+		llvm::consumeError(module.takeError());
+
+		return false;
+	}
+	// The parsed module is freed here, so everything that pointed into it is taken from the loaded one
+	std::string const mainFunctionName = m_mainFunction->getName().str();
+	m_builder->ClearInsertionPoint();
+	m_module = std::move(*module);
+	m_module->setModuleIdentifier(m_cacheKey);
+	m_mainFunction = m_module->getFunction(mainFunctionName);
+	m_mainBlock = m_mainFunction != nullptr ? &m_mainFunction->getEntryBlock() : nullptr;
+	m_printfFunction = m_module->getFunction("printf");
+	m_scanfFunction = m_module->getFunction("scanf");
+	m_callocFunction = m_module->getFunction("calloc");
+	m_freeFunction = m_module->getFunction("free");
+	m_fillFunctions.clear();
+	m_constantPool.Reset(m_module.get());
+
+	return true;
+}
+
+CompileResult const & LLParser::GetCompileResult() const
+{
+	return m_compileResult;
+}
+
+bool LLParser::PrepareCompilerSession()
+{
+	if (m_compilerSession == nullptr
+		|| !m_compilerSession->IsCreatedFor(m_compileOptions.targetCpu, m_compileOptions.targetFeatures))
+	{
+		m_compilerSession = std::make_unique<CompilerSession>(m_compileOptions.targetCpu, m_compileOptions.targetFeatures);
+	}
+	if (!m_compilerSession->IsReady())
+	{
+		PrintErrorMessage("Target: " + m_compilerSession->GetErrorMessage() + "\n");
+
+		return false;
+	}
+	m_compileResult.targetTriple = m_compilerSession->GetTargetTriple();
+	m_compileResult.targetCpu = m_compilerSession->GetTargetCpu();
+	m_compileResult.targetFeatures = m_compilerSession->GetTargetFeatures();
+	m_compileResult.relocationModel = m_compilerSession->GetTargetMachine().getRelocationModel();
+	m_compileResult.codeModel = m_compilerSession->GetTargetMachine().getCodeModel();
+
+	return true;
 }
 
 AstNode * LLParser::CreateAstNode(
 	std::string const & ruleName, unsigned int tokenCount
 )
 {
-	AstNode * astNode = new AstNode();
+	AstNode * astNode = AllocateAstNode();
 	astNode->name = ruleName;
 	for (unsigned int i = 0; i < tokenCount; ++i)
 	{
@@ -360,6 +771,31 @@ bool LLParser::ResolveAstActionName(std::string const & actionName)
 	return true;
 }
 
+bool LLParser::GetSymbolTableRowByName(std::string const & name, SymbolTableRow & result) const
+{
+	if (!m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(name), result))
+	{
+		return false;
+	}
+	if (result.llvmGlobalType != nullptr)
+	{
+		// Globals of earlier REPL inputs live in modules owned by the JIT, so they are redeclared in the current module
+		result.llvmPointer = m_module->getGlobalVariable(result.globalName);
+		if (result.llvmPointer == nullptr)
+		{
+			result.llvmPointer = new llvm::GlobalVariable(
+				*m_module, result.llvmGlobalType, false, llvm::GlobalValue::ExternalLinkage, nullptr, result.globalName);
+		}
+	}
+	return true;
+}
+
+std::string LLParser::CreateGlobalName(std::string const & variableName) const
+{
+	// Every REPL input has its own function name, so each declaration gets a symbol no other input defines
+	return "(" + variableName + ")_global_" + m_mainFunction->getName().str();
+}
+
 unsigned int LLParser::FindRowIndexInScopeByName(std::string const & name) const
 {
 	auto const & it = std::find_if(
@@ -385,6 +821,11 @@ bool LLParser::DestroyScopeAction()
 	for (std::pair<std::string, unsigned int> scopeElement : m_scopes.back())
 	{
 		unsigned int & symbolTableRowIndex = scopeElement.second;
+		SymbolTableRow symbolTableRow;
+		if (m_scopes.size() > 1 && m_symbolTable.GetSymbolTableRowByRowIndex(symbolTableRowIndex, symbolTableRow))
+		{
+			ReleaseVariable(symbolTableRow.llvmPointer);
+		}
 		m_symbolTable.RemoveRow(symbolTableRowIndex);
 	}
 	m_scopes.pop_back();
@@ -392,6 +833,62 @@ bool LLParser::DestroyScopeAction()
 	return true;
 }
 
+llvm::Value * LLParser::AllocateVariable(llvm::Type * type, std::string const & name)
+{
+	if (IsInDeadCode())
+	{
+		return llvm::UndefValue::get(type->getPointerTo());
+	}
+	bool isReused = false;
+	llvm::AllocaInst * slot = m_stackAllocator.Allocate(type, name, isReused);
+	if (isReused || m_scopes.size() > 1)
+	{
+		m_builder->CreateLifetimeStart(slot, m_builder->getInt64(m_dataLayout->getTypeAllocSize(type)));
+	}
+	return slot;
+}
+
+llvm::Value * LLParser::AllocateHeapVariable(llvm::Type * type, std::string const & name)
+{
+	if (IsInDeadCode())
+	{
+		return llvm::UndefValue::get(type->getPointerTo());
+	}
+	std::vector<llvm::Value*> arguments {
+		m_builder->getInt64(1),
+		m_builder->getInt64(m_dataLayout->getTypeAllocSize(type))
+	};
+	llvm::Value * memory = m_builder->CreateCall(CallocPrototype(), arguments, name + "_memory");
+	llvm::Value * heapPointer = m_builder->CreateBitCast(memory, type->getPointerTo(), name);
+	m_heapVariables.insert(heapPointer);
+
+	return heapPointer;
+}
+
+void LLParser::ReleaseVariable(llvm::Value * llvmPointer)
+{
+	auto * slot = llvm::dyn_cast_or_null<llvm::AllocaInst>(llvmPointer);
+	bool const isHeapVariable = m_heapVariables.erase(llvmPointer) != 0;
+	if (slot == nullptr && !isHeapVariable)
+	{
+		return;
+	}
+	llvm::IRBuilder<>::InsertPointGuard insertPointGuard(*m_builder);
+	if (llvm::Instruction * terminator = m_builder->GetInsertBlock()->getTerminator())
+	{
+		m_builder->SetInsertPoint(terminator);
+	}
+	if (isHeapVariable)
+	{
+		std::vector<llvm::Value*> arguments { m_builder->CreateBitCast(llvmPointer, llvm::Type::getInt8PtrTy(*m_context)) };
+		m_builder->CreateCall(FreePrototype(), arguments);
+
+		return;
+	}
+	m_builder->CreateLifetimeEnd(slot, m_builder->getInt64(m_dataLayout->getTypeAllocSize(slot->getAllocatedType())));
+	m_stackAllocator.Release(slot);
+}
+
 void LLParser::ComputeDimensions(AstNode * extendedType, std::vector<unsigned int> & dimensions)
 {
 	if (extendedType->children.empty())
@@ -432,34 +929,106 @@ bool LLParser::AddVariableToScope()
 	std::string & variableName = extendedType[1]->stringValue;
 	std::vector<unsigned int> dimensions;
 	ComputeDimensions(extendedType.front(), dimensions);
-	llvm::Type * arrayElementType = LlvmHelper::CreateType(m_context, variableType);
-	llvm::Type * llvmType = LlvmHelper::CreateType(m_context, variableType);
-	llvm::AllocaInst * llvmAllocaInst = nullptr;
-	if (variableType == TokenConstant::CoreType::Number::FLOAT && m_ast.back()->computedType == TokenConstant::CoreType::Number::INTEGER)
+	llvm::Type * arrayElementType = LlvmHelper::CreateType(*m_context, variableType);
+	llvm::Type * llvmType = LlvmHelper::CreateType(*m_context, variableType);
+	llvm::Value * llvmPointer = nullptr;
+	if (variableType == TokenConstant::CoreType::Number::FLOAT && m_ast.back()->computedType == TokenConstant::CoreType::Number::INTEGER && !IsInDeadCode())
 	{
 		m_ast.back()->llvmValue = LlvmHelper::ConvertToFloat(m_builder, m_ast.back()->llvmValue);
 	}
-	if (arraySizeString.empty())
-	{
-		llvmAllocaInst = m_builder->CreateAlloca(llvmType, nullptr, "(" + variableName + ")" + "_pointer");
-		m_builder->CreateStore(m_ast.back()->llvmValue, llvmAllocaInst);
-	}
-	else
+	if (!arraySizeString.empty())
 	{
 		for (size_t j = dimensions.size() - 1; j != SIZE_MAX; --j)
 		{
 			llvmType = llvm::ArrayType::get(llvmType, dimensions[j]);
 		}
-		llvmAllocaInst = m_builder->CreateAlloca(llvmType, nullptr, "(" + variableName + ")" + "_pointer");
-		CreateLlvmArrayAssignFunction(llvmAllocaInst, variableName, arrayElementType, std::accumulate(dimensions.begin(), dimensions.end(), 1, std::multiplies<>()));
 	}
-	m_scopes.back()[variableName] = m_symbolTable.CreateRow(variableType, variableName, llvmAllocaInst, dimensions);
+	bool const isGlobal = m_isReplMode && m_scopes.size() == 1;
+	bool const isSsaVariable = m_compileOptions.buildSsa && !isGlobal && arraySizeString.empty();
+	bool const isLargeArray = !arraySizeString.empty() && m_dataLayout->getTypeAllocSize(llvmType) > m_compileOptions.stackArrayLimit;
+	bool const isStaticArray = isLargeArray && !isGlobal && m_scopes.size() == 1;
+	llvm::Constant * arrayLiteral = nullptr;
+	if (!arraySizeString.empty() && m_ast.back()->llvmValue->getType() == llvmType)
+	{
+		arrayLiteral = llvm::dyn_cast<llvm::Constant>(m_ast.back()->llvmValue);
+	}
+	bool isInitialized = false;
+	if (isGlobal || isStaticArray)
+	{
+		isInitialized = arrayLiteral != nullptr;
+		llvmPointer = new llvm::GlobalVariable(
+			*m_module,
+			llvmType,
+			false,
+			isGlobal ? llvm::GlobalValue::ExternalLinkage : llvm::GlobalValue::InternalLinkage,
+			isInitialized ? arrayLiteral : llvm::Constant::getNullValue(llvmType),
+			isGlobal ? CreateGlobalName(variableName) : "(" + variableName + ")");
+	}
+	else if (isLargeArray)
+	{
+		isInitialized = arrayLiteral != nullptr && arrayLiteral->isNullValue();
+		llvmPointer = AllocateHeapVariable(llvmType, "(" + variableName + ")" + "_pointer");
+	}
+	else if (!isSsaVariable)
+	{
+		llvmPointer = AllocateVariable(llvmType, "(" + variableName + ")" + "_pointer");
+	}
+	if (!arraySizeString.empty() && !isInitialized)
+	{
+		CreateLlvmArrayAssignFunction(llvmPointer, variableName, arrayElementType, std::accumulate(dimensions.begin(), dimensions.end(), 1, std::multiplies<>()));
+	}
+	else if (!isSsaVariable && !IsInDeadCode())
+	{
+		m_builder->CreateStore(LlvmHelper::ConvertToType(m_builder, m_ast.back()->llvmValue, llvmType), llvmPointer);
+	}
+	unsigned int const rowIndex = m_symbolTable.CreateRow(variableType, variableName, llvmPointer, llvmType, dimensions);
+	if (isGlobal)
+	{
+		m_symbolTable.SetGlobal(rowIndex, llvmType, llvmPointer->getName().str());
+		m_replInputGlobalNames.emplace_back(variableName);
+	}
+	if (isSsaVariable)
+	{
+		m_ssaBuilder.DeclareVariable(rowIndex, llvmType);
+		WriteSsaVariable(rowIndex, variableType, m_ast.back()->llvmValue);
+	}
+	m_scopes.back()[variableName] = rowIndex;
 
 	return true;
 }
 
+llvm::Value * LLParser::CreateArrayElementPointer(SymbolTableRow const & symbolTableRow, AstNode * indicesNode, std::string & elementName)
+{
+	std::vector<AstNode*> const singleIndexNode { indicesNode };
+	std::vector<AstNode*> const & indexNodes = indicesNode->children.empty() ? singleIndexNode : indicesNode->children;
+	std::vector<llvm::Value*> indices { LlvmHelper::CreateInteger64Constant(*m_context, 0) };
+	indices.reserve(indexNodes.size() + 1);
+	for (AstNode * indexNode : indexNodes)
+	{
+		indices.emplace_back(m_builder->CreateSExtOrTrunc(indexNode->llvmValue, llvm::Type::getInt64Ty(*m_context)));
+	}
+	// Element names only make printed IR readable, so they are not built when no IR is printed
+	elementName.clear();
+	if (m_compileOptions.irOutput == nullptr)
+	{
+		return m_builder->CreateInBoundsGEP(symbolTableRow.arrayInformation->llvmType, symbolTableRow.llvmPointer, indices);
+	}
+	elementName = "(" + symbolTableRow.name + "[";
+	for (size_t i = 0; i < indexNodes.size(); ++i)
+	{
+		elementName += (i == 0 ? "" : ", ") + indexNodes[i]->stringValue;
+	}
+	elementName += "])";
+
+	return m_builder->CreateInBoundsGEP(symbolTableRow.arrayInformation->llvmType, symbolTableRow.llvmPointer, indices, elementName + "_pointer");
+}
+
 bool LLParser::UpdateVariableInScope()
 {
+	if (IsInDeadCode())
+	{
+		return true;
+	}
 	bool arrayAccessing = false;
 	std::string variableName;
 	if (m_ast[m_ast.size() - 3]->stringValue.empty() && !m_ast[m_ast.size() - 3]->children.empty())
@@ -473,49 +1042,29 @@ bool LLParser::UpdateVariableInScope()
 	}
 
 	SymbolTableRow symbolTableRow;
-	m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(variableName), symbolTableRow);
-	if (symbolTableRow.arrayInformation == nullptr)
+	GetSymbolTableRowByName(variableName, symbolTableRow);
+	if (symbolTableRow.arrayInformation == nullptr && symbolTableRow.llvmPointer == nullptr)
+	{
+		WriteSsaVariable(FindRowIndexInScopeByName(variableName), symbolTableRow.type, m_ast.back()->llvmValue);
+	}
+	else if (symbolTableRow.arrayInformation == nullptr)
 	{
-		m_builder->CreateStore(m_ast.back()->llvmValue, symbolTableRow.llvmAllocaInst);
+		llvm::Type * variableType = LlvmHelper::CreateType(*m_context, symbolTableRow.type);
+		m_builder->CreateStore(LlvmHelper::ConvertToType(m_builder, m_ast.back()->llvmValue, variableType), symbolTableRow.llvmPointer);
 	}
 	else
 	{
 		if (arrayAccessing)
 		{
-			llvm::Value * inBoundsGetElementPointer = symbolTableRow.llvmAllocaInst;
-			if (m_ast[m_ast.size() - 3]->children.back()->children.empty())
-			{
-				AstNode * child = m_ast[m_ast.size() - 3]->children.back();
-				llvm::Type * arrayType = LlvmHelper::CreateType(m_context, symbolTableRow.type, std::to_string(symbolTableRow.arrayInformation->dimensions.front()));
-				llvm::Value * index64Bit = m_builder->CreateSExtOrTrunc(child->llvmValue, llvm::Type::getInt64Ty(m_context));
-				inBoundsGetElementPointer = m_builder->CreateInBoundsGEP(arrayType, inBoundsGetElementPointer, { LlvmHelper::CreateInteger64Constant(m_context, 0), index64Bit }, "([" + child->stringValue + "])_pointer");
-			}
-			else
-			{
-				std::string variableName = symbolTableRow.name + "[";
-				for (size_t i = 0; i < m_ast[m_ast.size() - 3]->children.back()->children.size(); ++i)
-				{
-					AstNode * child = m_ast[m_ast.size() - 3]->children.back()->children[i];
-					variableName += child->stringValue;
-					llvm::Type * arrayType = LlvmHelper::CreateType(m_context, symbolTableRow.type);
-					for (size_t j = m_ast[m_ast.size() - 3]->children.back()->children.size() - 1; j != SIZE_MAX + i; --j)
-					{
-						arrayType = llvm::ArrayType::get(arrayType, symbolTableRow.arrayInformation->dimensions[j]);
-					}
-					llvm::Value * index64Bit = m_builder->CreateSExtOrTrunc(child->llvmValue, llvm::Type::getInt64Ty(m_context));
-					inBoundsGetElementPointer = m_builder->CreateInBoundsGEP(arrayType, inBoundsGetElementPointer, { LlvmHelper::CreateInteger64Constant(m_context, 0), index64Bit }, "(" + variableName + "])_pointer");
-					if (i < m_ast[m_ast.size() - 3]->children.back()->children.size() - 1)
-					{
-						variableName += ", ";
-					}
-				}
-			}
-			m_builder->CreateStore(m_ast.back()->llvmValue, inBoundsGetElementPointer);
+			std::string elementName;
+			llvm::Value * inBoundsGetElementPointer = CreateArrayElementPointer(symbolTableRow, m_ast[m_ast.size() - 3]->children.back(), elementName);
+			llvm::Type * arrayElementType = LlvmHelper::CreateType(*m_context, symbolTableRow.type);
+			m_builder->CreateStore(LlvmHelper::ConvertToType(m_builder, m_ast.back()->llvmValue, arrayElementType), inBoundsGetElementPointer);
 		}
 		else
 		{
-			llvm::Type * arrayElementType = LlvmHelper::CreateType(m_context, symbolTableRow.type);
-			CreateLlvmArrayAssignFunction(symbolTableRow.llvmAllocaInst, variableName, arrayElementType, std::accumulate(symbolTableRow.arrayInformation->dimensions.begin(), symbolTableRow.arrayInformation->dimensions.end(), 1, std::multiplies<>()));
+			llvm::Type * arrayElementType = LlvmHelper::CreateType(*m_context, symbolTableRow.type);
+			CreateLlvmArrayAssignFunction(symbolTableRow.llvmPointer, variableName, arrayElementType, symbolTableRow.arrayInformation->elementCount);
 		}
 	}
 
@@ -602,24 +1151,35 @@ bool LLParser::SynthesisPlus()
 	}
 	if (identifiersExists)
 	{
+		std::string name = "(" + lhs + " + " + rhs + ")";
+		llvm::Value * result;
+		if (IsInDeadCode())
+		{
+			result = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, resultType));
+		}
+		else if (!ExpressionSimplifier::TrySimplify(m_builder, llvm::Instruction::Add, resultType, *lhsNode, *rhsNode, name, result))
+		{
+			result = LlvmHelper::CreateAdd(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, name);
+		}
 		lhsNode->type = TokenConstant::Name::IDENTIFIER;
-		lhsNode->stringValue = "(" + lhs + " + " + rhs + ")";
+		lhsNode->stringValue = name;
 		lhsNode->isTemporaryIdentifier = true;
-		lhsNode->llvmValue = LlvmHelper::CreateAdd(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+		lhsNode->llvmValue = result;
 	}
 	else
 	{
-		std::string operationResult;
+		LiteralValue operationResult;
 		std::string errorMessage;
-		if (!Calculator::Add(lhs, rhs, resultType, operationResult, errorMessage))
+		if (!Calculator::Add(lhsNode->literalValue, rhsNode->literalValue, operationResult, errorMessage))
 		{
 			PrintErrorMessage(errorMessage);
 
 			return false;
 		}
 		lhsNode->type = resultType;
-		lhsNode->llvmValue = LlvmHelper::CreateConstant(m_context, resultType, operationResult);
-		lhsNode->stringValue = operationResult;
+		lhsNode->llvmValue = LlvmHelper::CreateConstant(*m_context, resultType, operationResult);
+		lhsNode->stringValue = operationResult.ToString();
+		lhsNode->literalValue = operationResult;
 	}
 	lhsNode->computedType = resultType;
 	lhsNode->children.clear();
@@ -656,7 +1216,7 @@ bool LLParser::SynthesisMinus()
 	bool isUnaryMinus = IsUnaryMinus(lhs);
 	if (isUnaryMinus)
 	{
-		lhsNode = CreateLiteralAstNode(TokenConstant::CoreType::Number::INTEGER, "0");
+		lhsNode = CreateLiteralAstNode(TokenConstant::CoreType::Number::INTEGER, LiteralValue(int64_t(0)));
 		lhsType = lhsNode->type;
 		lhs = lhsNode->stringValue;
 
@@ -673,24 +1233,35 @@ bool LLParser::SynthesisMinus()
 	}
 	if (identifiersExists)
 	{
+		std::string name = "(" + lhs + " - " + rhs + ")";
+		llvm::Value * result;
+		if (IsInDeadCode())
+		{
+			result = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, resultType));
+		}
+		else if (!ExpressionSimplifier::TrySimplify(m_builder, llvm::Instruction::Sub, resultType, *lhsNode, *rhsNode, name, result))
+		{
+			result = LlvmHelper::CreateSub(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, name);
+		}
 		lhsNode->type = TokenConstant::Name::IDENTIFIER;
-		lhsNode->stringValue = "(" + lhs + " - " + rhs + ")";
+		lhsNode->stringValue = name;
 		lhsNode->isTemporaryIdentifier = true;
-		lhsNode->llvmValue = LlvmHelper::CreateSub(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+		lhsNode->llvmValue = result;
 	}
 	else
 	{
-		std::string operationResult;
+		LiteralValue operationResult;
 		std::string errorMessage;
-		if (!Calculator::Subtract(lhs, rhs, resultType, operationResult, errorMessage))
+		if (!Calculator::Subtract(lhsNode->literalValue, rhsNode->literalValue, operationResult, errorMessage))
 		{
 			PrintErrorMessage(errorMessage);
 
 			return false;
 		}
 		lhsNode->type = resultType;
-		lhsNode->stringValue = operationResult;
-		lhsNode->llvmValue = LlvmHelper::CreateConstant(m_context, resultType, operationResult);
+		lhsNode->stringValue = operationResult.ToString();
+		lhsNode->literalValue = operationResult;
+		lhsNode->llvmValue = LlvmHelper::CreateConstant(*m_context, resultType, operationResult);
 	}
 	lhsNode->computedType = resultType;
 	lhsNode->children.clear();
@@ -740,24 +1311,35 @@ bool LLParser::SynthesisMultiply()
 
 	if (identifiersExists)
 	{
+		std::string name = "(" + lhs + " * " + rhs + ")";
+		llvm::Value * result;
+		if (IsInDeadCode())
+		{
+			result = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, resultType));
+		}
+		else if (!ExpressionSimplifier::TrySimplify(m_builder, llvm::Instruction::Mul, resultType, *lhsNode, *rhsNode, name, result))
+		{
+			result = LlvmHelper::CreateMul(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, name);
+		}
 		lhsNode->type = TokenConstant::Name::IDENTIFIER;
-		lhsNode->stringValue = "(" + lhs + " * " + rhs + ")";
+		lhsNode->stringValue = name;
 		lhsNode->isTemporaryIdentifier = true;
-		lhsNode->llvmValue = LlvmHelper::CreateMul(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+		lhsNode->llvmValue = result;
 	}
 	else
 	{
-		std::string operationResult;
+		LiteralValue operationResult;
 		std::string errorMessage;
-		if (!Calculator::Multiply(lhs, rhs, resultType, operationResult, errorMessage))
+		if (!Calculator::Multiply(lhsNode->literalValue, rhsNode->literalValue, operationResult, errorMessage))
 		{
 			PrintErrorMessage(errorMessage);
 
 			return false;
 		}
 		lhsNode->type = resultType;
-		lhsNode->llvmValue = LlvmHelper::CreateConstant(m_context, resultType, operationResult);
-		lhsNode->stringValue = operationResult;
+		lhsNode->llvmValue = LlvmHelper::CreateConstant(*m_context, resultType, operationResult);
+		lhsNode->stringValue = operationResult.ToString();
+		lhsNode->literalValue = operationResult;
 	}
 	lhsNode->computedType = resultType;
 	lhsNode->children.clear();
@@ -804,24 +1386,35 @@ bool LLParser::SynthesisIntegerDivision()
 	if (identifiersExists)
 	{
 		resultType = TokenConstant::CoreType::Number::INTEGER;
+		std::string name = "(" + lhs + " // " + rhs + ")";
+		llvm::Value * result;
+		if (IsInDeadCode())
+		{
+			result = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, resultType));
+		}
+		else if (!ExpressionSimplifier::TrySimplify(m_builder, llvm::Instruction::SDiv, resultType, *lhsNode, *rhsNode, name, result))
+		{
+			result = LlvmHelper::CreateExactSDiv(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, name);
+		}
 		lhsNode->type = TokenConstant::Name::IDENTIFIER;
-		lhsNode->stringValue = "(" + lhs + " // " + rhs + ")";
+		lhsNode->stringValue = name;
 		lhsNode->isTemporaryIdentifier = true;
-		lhsNode->llvmValue = LlvmHelper::CreateExactSDiv(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+		lhsNode->llvmValue = result;
 	}
 	else
 	{
-		std::string operationResult;
+		LiteralValue operationResult;
 		std::string errorMessage;
-		if (!Calculator::IntegerDivision(lhs, rhs, TokenConstant::CoreType::Number::INTEGER, operationResult, errorMessage))
+		if (!Calculator::IntegerDivision(lhsNode->literalValue, rhsNode->literalValue, operationResult, errorMessage))
 		{
 			PrintErrorMessage(errorMessage);
 
 			return false;
 		}
 		lhsNode->type = TokenConstant::CoreType::Number::INTEGER;
-		lhsNode->llvmValue = LlvmHelper::CreateConstant(m_context, TokenConstant::CoreType::Number::INTEGER, operationResult);
-		lhsNode->stringValue = operationResult;
+		lhsNode->llvmValue = LlvmHelper::CreateConstant(*m_context, TokenConstant::CoreType::Number::INTEGER, operationResult);
+		lhsNode->stringValue = operationResult.ToString();
+		lhsNode->literalValue = operationResult;
 	}
 	lhsNode->computedType = TokenConstant::CoreType::Number::INTEGER;
 	lhsNode->children.clear();
@@ -868,24 +1461,35 @@ bool LLParser::SynthesisDivision()
 	if (identifiersExists)
 	{
 		resultType = TokenConstant::CoreType::Number::FLOAT;
+		std::string name = "(" + lhs + " / " + rhs + ")";
+		llvm::Value * result;
+		if (IsInDeadCode())
+		{
+			result = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, resultType));
+		}
+		else if (!ExpressionSimplifier::TrySimplify(m_builder, llvm::Instruction::FDiv, resultType, *lhsNode, *rhsNode, name, result))
+		{
+			result = LlvmHelper::CreateSDiv(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, name);
+		}
 		lhsNode->type = TokenConstant::Name::IDENTIFIER;
-		lhsNode->stringValue = "(" + lhs + " / " + rhs + ")";
+		lhsNode->stringValue = name;
 		lhsNode->isTemporaryIdentifier = true;
-		lhsNode->llvmValue = LlvmHelper::CreateSDiv(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+		lhsNode->llvmValue = result;
 	}
 	else
 	{
-		std::string operationResult;
+		LiteralValue operationResult;
 		std::string errorMessage;
-		if (!Calculator::Division(lhs, rhs, TokenConstant::CoreType::Number::FLOAT, operationResult, errorMessage))
+		if (!Calculator::Division(lhsNode->literalValue, rhsNode->literalValue, operationResult, errorMessage))
 		{
 			PrintErrorMessage(errorMessage);
 
 			return false;
 		}
 		lhsNode->type = TokenConstant::CoreType::Number::FLOAT;
-		lhsNode->llvmValue = LlvmHelper::CreateConstant(m_context, TokenConstant::CoreType::Number::FLOAT, operationResult);
-		lhsNode->stringValue = operationResult;
+		lhsNode->llvmValue = LlvmHelper::CreateConstant(*m_context, TokenConstant::CoreType::Number::FLOAT, operationResult);
+		lhsNode->stringValue = operationResult.ToString();
+		lhsNode->literalValue = operationResult;
 	}
 	lhsNode->computedType = TokenConstant::CoreType::Number::FLOAT;
 	lhsNode->children.clear();
@@ -931,24 +1535,39 @@ bool LLParser::SynthesisModulus()
 
 	if (identifiersExists)
 	{
+		std::string name = lhs + " % " + rhs;
+		llvm::Value * result;
+		if (IsInDeadCode())
+		{
+			result = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, resultType));
+		}
+		else if (!ExpressionSimplifier::TrySimplify(m_builder, llvm::Instruction::SRem, resultType, *lhsNode, *rhsNode, name, result))
+		{
+			result = LlvmHelper::CreateSRem(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, name);
+		}
 		lhsNode->type = TokenConstant::Name::IDENTIFIER;
-		lhsNode->stringValue = lhs + " % " + rhs;
+		lhsNode->stringValue = name;
 		lhsNode->isTemporaryIdentifier = true;
-		lhsNode->llvmValue = LlvmHelper::CreateSRem(m_builder, resultType, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+		lhsNode->llvmValue = result;
 	}
 	else
 	{
-		std::string operationResult;
+		LiteralValue operationResult;
 		std::string errorMessage;
-		if (!Calculator::Modulus(lhs, rhs, resultType, operationResult, errorMessage))
+		if (!Calculator::Modulus(lhsNode->literalValue, rhsNode->literalValue, operationResult, errorMessage))
 		{
 			PrintErrorMessage(errorMessage);
 
 			return false;
 		}
+		if (resultType == TokenConstant::CoreType::Number::FLOAT)
+		{
+			operationResult = LiteralValue(operationResult.GetFloat());
+		}
 		lhsNode->type = resultType;
-		lhsNode->llvmValue = LlvmHelper::CreateConstant(m_context, resultType, operationResult);
-		lhsNode->stringValue = operationResult;
+		lhsNode->llvmValue = LlvmHelper::CreateConstant(*m_context, resultType, operationResult);
+		lhsNode->stringValue = operationResult.ToString();
+		lhsNode->literalValue = operationResult;
 	}
 	lhsNode->computedType = resultType;
 	lhsNode->children.clear();
@@ -992,13 +1611,31 @@ bool LLParser::SynthesisEquivalence()
 
 		return false;
 	}
-	lhsNode->type = TokenConstant::Name::IDENTIFIER;
-	lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
-	lhsNode->isTemporaryIdentifier = true;
-	lhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, lhsNode->llvmValue);
-	rhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, rhsNode->llvmValue);
-	lhsNode->llvmValue = m_builder->CreateFCmp(llvm::FCmpInst::FCMP_OEQ, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
-	lhsNode->computedType = resultType;
+	if (identifiersExists || lhsNode->literalValue.IsEmpty() || rhsNode->literalValue.IsEmpty())
+	{
+		lhsNode->type = TokenConstant::Name::IDENTIFIER;
+		lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
+		lhsNode->isTemporaryIdentifier = true;
+		lhsNode->llvmValue = IsInDeadCode()
+			? llvm::UndefValue::get(llvm::Type::getInt1Ty(*m_context))
+			: LlvmHelper::CreateCompare(m_builder, llvm::FCmpInst::FCMP_OEQ, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+	}
+	else
+	{
+		bool comparisonResult;
+		std::string errorMessage;
+		if (!Calculator::Equivalence(lhsNode->literalValue, rhsNode->literalValue, comparisonResult, errorMessage))
+		{
+			PrintErrorMessage(errorMessage);
+
+			return false;
+		}
+		lhsNode->type = TokenConstant::CoreType::BOOLEAN;
+		lhsNode->literalValue = LiteralValue(comparisonResult);
+		lhsNode->stringValue = lhsNode->literalValue.ToString();
+		lhsNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, comparisonResult);
+	}
+	lhsNode->computedType = TokenConstant::CoreType::BOOLEAN;
 	lhsNode->children.clear();
 	m_ast.back()->children.clear();
 
@@ -1040,13 +1677,31 @@ bool LLParser::SynthesisNotEquivalence()
 
 		return false;
 	}
-	lhsNode->type = TokenConstant::Name::IDENTIFIER;
-	lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
-	lhsNode->isTemporaryIdentifier = true;
-	lhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, lhsNode->llvmValue);
-	rhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, rhsNode->llvmValue);
-	lhsNode->llvmValue = m_builder->CreateFCmp(llvm::FCmpInst::FCMP_ONE, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
-	lhsNode->computedType = resultType;
+	if (identifiersExists || lhsNode->literalValue.IsEmpty() || rhsNode->literalValue.IsEmpty())
+	{
+		lhsNode->type = TokenConstant::Name::IDENTIFIER;
+		lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
+		lhsNode->isTemporaryIdentifier = true;
+		lhsNode->llvmValue = IsInDeadCode()
+			? llvm::UndefValue::get(llvm::Type::getInt1Ty(*m_context))
+			: LlvmHelper::CreateCompare(m_builder, llvm::FCmpInst::FCMP_ONE, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+	}
+	else
+	{
+		bool comparisonResult;
+		std::string errorMessage;
+		if (!Calculator::NotEquivalence(lhsNode->literalValue, rhsNode->literalValue, comparisonResult, errorMessage))
+		{
+			PrintErrorMessage(errorMessage);
+
+			return false;
+		}
+		lhsNode->type = TokenConstant::CoreType::BOOLEAN;
+		lhsNode->literalValue = LiteralValue(comparisonResult);
+		lhsNode->stringValue = lhsNode->literalValue.ToString();
+		lhsNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, comparisonResult);
+	}
+	lhsNode->computedType = TokenConstant::CoreType::BOOLEAN;
 	lhsNode->children.clear();
 	m_ast.back()->children.clear();
 
@@ -1081,20 +1736,38 @@ bool LLParser::SynthesisMoreOrEquivalence()
 	std::string & resultType = lhsType;
 	if (!AreTypesCompatible(lhsType, rhsType, resultType))
 	{
-		PrintErrorMessage(
-			"Cannot compare for equivalence \"" + lhs + "\"" + "(" + "\"" + lhsType + "\"" + " type" + ")"
-			+ " with " + "\"" + rhs + "\"" + "(" + "\"" + rhsType + "\"" + " type" + ")" + "\n"
-		);
+		PrintErrorMessage(
+			"Cannot compare for equivalence \"" + lhs + "\"" + "(" + "\"" + lhsType + "\"" + " type" + ")"
+			+ " with " + "\"" + rhs + "\"" + "(" + "\"" + rhsType + "\"" + " type" + ")" + "\n"
+		);
+
+		return false;
+	}
+	if (identifiersExists || lhsNode->literalValue.IsEmpty() || rhsNode->literalValue.IsEmpty())
+	{
+		lhsNode->type = TokenConstant::Name::IDENTIFIER;
+		lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
+		lhsNode->isTemporaryIdentifier = true;
+		lhsNode->llvmValue = IsInDeadCode()
+			? llvm::UndefValue::get(llvm::Type::getInt1Ty(*m_context))
+			: LlvmHelper::CreateCompare(m_builder, llvm::FCmpInst::FCMP_OGE, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+	}
+	else
+	{
+		bool comparisonResult;
+		std::string errorMessage;
+		if (!Calculator::MoreOrEquivalence(lhsNode->literalValue, rhsNode->literalValue, comparisonResult, errorMessage))
+		{
+			PrintErrorMessage(errorMessage);
 
-		return false;
+			return false;
+		}
+		lhsNode->type = TokenConstant::CoreType::BOOLEAN;
+		lhsNode->literalValue = LiteralValue(comparisonResult);
+		lhsNode->stringValue = lhsNode->literalValue.ToString();
+		lhsNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, comparisonResult);
 	}
-	lhsNode->type = TokenConstant::Name::IDENTIFIER;
-	lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
-	lhsNode->isTemporaryIdentifier = true;
-	lhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, lhsNode->llvmValue);
-	rhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, rhsNode->llvmValue);
-	lhsNode->llvmValue = m_builder->CreateFCmp(llvm::FCmpInst::FCMP_OGE, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
-	lhsNode->computedType = resultType;
+	lhsNode->computedType = TokenConstant::CoreType::BOOLEAN;
 	lhsNode->children.clear();
 	m_ast.back()->children.clear();
 
@@ -1136,13 +1809,31 @@ bool LLParser::SynthesisLessOrEquivalence()
 
 		return false;
 	}
-	lhsNode->type = TokenConstant::Name::IDENTIFIER;
-	lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
-	lhsNode->isTemporaryIdentifier = true;
-	lhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, lhsNode->llvmValue);
-	rhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, rhsNode->llvmValue);
-	lhsNode->llvmValue = m_builder->CreateFCmp(llvm::FCmpInst::FCMP_OLE, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
-	lhsNode->computedType = resultType;
+	if (identifiersExists || lhsNode->literalValue.IsEmpty() || rhsNode->literalValue.IsEmpty())
+	{
+		lhsNode->type = TokenConstant::Name::IDENTIFIER;
+		lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
+		lhsNode->isTemporaryIdentifier = true;
+		lhsNode->llvmValue = IsInDeadCode()
+			? llvm::UndefValue::get(llvm::Type::getInt1Ty(*m_context))
+			: LlvmHelper::CreateCompare(m_builder, llvm::FCmpInst::FCMP_OLE, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+	}
+	else
+	{
+		bool comparisonResult;
+		std::string errorMessage;
+		if (!Calculator::LessOrEquivalence(lhsNode->literalValue, rhsNode->literalValue, comparisonResult, errorMessage))
+		{
+			PrintErrorMessage(errorMessage);
+
+			return false;
+		}
+		lhsNode->type = TokenConstant::CoreType::BOOLEAN;
+		lhsNode->literalValue = LiteralValue(comparisonResult);
+		lhsNode->stringValue = lhsNode->literalValue.ToString();
+		lhsNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, comparisonResult);
+	}
+	lhsNode->computedType = TokenConstant::CoreType::BOOLEAN;
 	lhsNode->children.clear();
 	m_ast.back()->children.clear();
 
@@ -1184,13 +1875,31 @@ bool LLParser::SynthesisMore()
 
 		return false;
 	}
-	lhsNode->type = TokenConstant::Name::IDENTIFIER;
-	lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
-	lhsNode->isTemporaryIdentifier = true;
-	lhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, lhsNode->llvmValue);
-	rhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, rhsNode->llvmValue);
-	lhsNode->llvmValue = m_builder->CreateFCmp(llvm::FCmpInst::FCMP_OGT, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
-	lhsNode->computedType = resultType;
+	if (identifiersExists || lhsNode->literalValue.IsEmpty() || rhsNode->literalValue.IsEmpty())
+	{
+		lhsNode->type = TokenConstant::Name::IDENTIFIER;
+		lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
+		lhsNode->isTemporaryIdentifier = true;
+		lhsNode->llvmValue = IsInDeadCode()
+			? llvm::UndefValue::get(llvm::Type::getInt1Ty(*m_context))
+			: LlvmHelper::CreateCompare(m_builder, llvm::FCmpInst::FCMP_OGT, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+	}
+	else
+	{
+		bool comparisonResult;
+		std::string errorMessage;
+		if (!Calculator::More(lhsNode->literalValue, rhsNode->literalValue, comparisonResult, errorMessage))
+		{
+			PrintErrorMessage(errorMessage);
+
+			return false;
+		}
+		lhsNode->type = TokenConstant::CoreType::BOOLEAN;
+		lhsNode->literalValue = LiteralValue(comparisonResult);
+		lhsNode->stringValue = lhsNode->literalValue.ToString();
+		lhsNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, comparisonResult);
+	}
+	lhsNode->computedType = TokenConstant::CoreType::BOOLEAN;
 	lhsNode->children.clear();
 	m_ast.back()->children.clear();
 
@@ -1232,13 +1941,31 @@ bool LLParser::SynthesisLess()
 
 		return false;
 	}
-	lhsNode->type = TokenConstant::Name::IDENTIFIER;
-	lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
-	lhsNode->isTemporaryIdentifier = true;
-	lhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, lhsNode->llvmValue);
-	rhsNode->llvmValue = LlvmHelper::ConvertToFloat(m_builder, rhsNode->llvmValue);
-	lhsNode->llvmValue = m_builder->CreateFCmp(llvm::FCmpInst::FCMP_OLT, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
-	lhsNode->computedType = resultType;
+	if (identifiersExists || lhsNode->literalValue.IsEmpty() || rhsNode->literalValue.IsEmpty())
+	{
+		lhsNode->type = TokenConstant::Name::IDENTIFIER;
+		lhsNode->stringValue = "(" + lhs + " == " + rhs + ")";
+		lhsNode->isTemporaryIdentifier = true;
+		lhsNode->llvmValue = IsInDeadCode()
+			? llvm::UndefValue::get(llvm::Type::getInt1Ty(*m_context))
+			: LlvmHelper::CreateCompare(m_builder, llvm::FCmpInst::FCMP_OLT, lhsNode->llvmValue, rhsNode->llvmValue, lhsNode->stringValue);
+	}
+	else
+	{
+		bool comparisonResult;
+		std::string errorMessage;
+		if (!Calculator::Less(lhsNode->literalValue, rhsNode->literalValue, comparisonResult, errorMessage))
+		{
+			PrintErrorMessage(errorMessage);
+
+			return false;
+		}
+		lhsNode->type = TokenConstant::CoreType::BOOLEAN;
+		lhsNode->literalValue = LiteralValue(comparisonResult);
+		lhsNode->stringValue = lhsNode->literalValue.ToString();
+		lhsNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, comparisonResult);
+	}
+	lhsNode->computedType = TokenConstant::CoreType::BOOLEAN;
 	lhsNode->children.clear();
 	m_ast.back()->children.clear();
 
@@ -1282,7 +2009,7 @@ bool LLParser::CheckVariableTypeWithAssignmentRightHandTypeForEquality() const
 		if (rhsNode->computedType == TokenConstant::Name::IDENTIFIER)
 		{
 			SymbolTableRow symbolTableRow;
-			m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(rightHandValue), symbolTableRow);
+			GetSymbolTableRowByName(rightHandValue, symbolTableRow);
 			rightHandType = symbolTableRow.type;
 		}
 		else
@@ -1339,7 +2066,7 @@ bool LLParser::CheckIdentifierTypeWithAssignmentRightHandTypeForEquality() const
 		variableName = m_ast[m_ast.size() - 3]->stringValue;
 	}
 	SymbolTableRow symbolTableRow;
-	m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(variableName), symbolTableRow);
+	GetSymbolTableRowByName(variableName, symbolTableRow);
 	std::string & variableType = symbolTableRow.type;
 	if (symbolTableRow.arrayInformation != nullptr)
 	{
@@ -1366,7 +2093,7 @@ bool LLParser::CheckIdentifierTypeWithAssignmentRightHandTypeForEquality() const
 		if (rhsNode->computedType == TokenConstant::Name::IDENTIFIER)
 		{
 			SymbolTableRow symbolTableRow;
-			m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(rightHandValue), symbolTableRow);
+			GetSymbolTableRowByName(rightHandValue, symbolTableRow);
 			rightHandType = symbolTableRow.type;
 		}
 		else
@@ -1411,7 +2138,7 @@ bool LLParser::SynthesisType()
 	if (m_ast.back()->computedType == TokenConstant::Name::IDENTIFIER)
 	{
 		SymbolTableRow symbolTableRow;
-		if (m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(m_ast.back()->children.front()->stringValue), symbolTableRow))
+		if (GetSymbolTableRowByName(m_ast.back()->children.front()->stringValue, symbolTableRow))
 		{
 			m_ast.back()->computedType = symbolTableRow.type;
 		}
@@ -1502,8 +2229,13 @@ bool LLParser::CreateLlvmStringLiteral()
 			stringLiteral += astNode->stringValue[i];
 		}
 	}
-	std::string name = astNode->name + ": `" + stringLiteral + "`";
-	astNode->llvmValue = m_builder->CreateGlobalStringPtr(stringLiteral, name);
+	if (IsInDeadCode())
+	{
+		astNode->llvmValue = llvm::UndefValue::get(llvm::Type::getInt8PtrTy(*m_context));
+
+		return true;
+	}
+	astNode->llvmValue = m_constantPool.GetString(stringLiteral);
 
 	return true;
 }
@@ -1511,7 +2243,11 @@ bool LLParser::CreateLlvmStringLiteral()
 bool LLParser::CreateLlvmCharacterLiteral()
 {
 	AstNode * astNode = m_ast.back();
-	astNode->llvmValue = LlvmHelper::CreateCharacterConstant(m_context, astNode->stringValue[1]);
+	if (!ParseLiteralValue(astNode, TokenConstant::CoreType::CHARACTER))
+	{
+		return false;
+	}
+	astNode->llvmValue = LlvmHelper::CreateCharacterConstant(*m_context, astNode->literalValue.GetCharacter());
 
 	return true;
 }
@@ -1519,42 +2255,79 @@ bool LLParser::CreateLlvmCharacterLiteral()
 bool LLParser::CreateLlvmBooleanLiteral()
 {
 	AstNode * astNode = m_ast.back();
-	astNode->llvmValue = LlvmHelper::CreateBooleanConstant(m_context, astNode->stringValue);
+	if (!ParseLiteralValue(astNode, TokenConstant::CoreType::BOOLEAN))
+	{
+		return false;
+	}
+	astNode->llvmValue = LlvmHelper::CreateBooleanConstant(*m_context, astNode->literalValue.GetBoolean());
 
 	return true;
 }
 
 void LLParser::ComputeArrayLiteralValues(std::vector<AstNode*> const & astNodes, std::vector<llvm::Constant*> & arrayLiteralValues)
 {
+	arrayLiteralValues.reserve(astNodes.size());
 	for (AstNode * astNode : astNodes)
 	{
+		if (astNode->llvmValue == nullptr)
+		{
+			astNode->llvmValue = astNode->literalValue.IsFloat()
+				? LlvmHelper::CreateFloatConstant(*m_context, astNode->literalValue.GetFloat())
+				: LlvmHelper::CreateInteger32Constant(*m_context, static_cast<int>(astNode->literalValue.GetInteger()));
+		}
 		arrayLiteralValues.emplace_back((llvm::Constant*)astNode->llvmValue);
 	}
 }
 
-void LLParser::ComputeArrayLiteralName(AstNode * arrayLiteralNode, std::string & arrayLiteralName)
+bool LLParser::TryToComputeArrayLiteralData(std::vector<AstNode*> const & astNodes, llvm::Type * elementType, llvm::Constant *& constant)
 {
-	std::string arrayLiteralString = "[";
-	for (size_t i = 0; i < arrayLiteralNode->children.size(); ++i)
+	if (elementType->isIntegerTy(32))
 	{
-		AstNode * arrayLiteralValue = arrayLiteralNode->children[i];
-		std::string arrayLiteralStringPart;
-		if (arrayLiteralValue->stringValue.empty())
+		std::vector<uint32_t> data;
+		data.reserve(astNodes.size());
+		for (AstNode * astNode : astNodes)
 		{
-			ComputeArrayLiteralName(arrayLiteralValue, arrayLiteralStringPart);
+			if (!astNode->literalValue.IsInteger())
+			{
+				return false;
+			}
+			data.emplace_back(static_cast<uint32_t>(astNode->literalValue.GetInteger()));
 		}
-		else
+		constant = llvm::ConstantDataArray::get(*m_context, llvm::ArrayRef<uint32_t>(data));
+	}
+	else if (elementType->isDoubleTy())
+	{
+		std::vector<double> data;
+		data.reserve(astNodes.size());
+		for (AstNode * astNode : astNodes)
 		{
-			arrayLiteralStringPart = arrayLiteralValue->stringValue;
+			if (!astNode->literalValue.IsFloat())
+			{
+				return false;
+			}
+			data.emplace_back(astNode->literalValue.GetFloat());
 		}
-		arrayLiteralString += arrayLiteralStringPart;
-		if (i < arrayLiteralNode->children.size() - 1)
+		constant = llvm::ConstantDataArray::get(*m_context, llvm::ArrayRef<double>(data));
+	}
+	else if (elementType->isIntegerTy(8))
+	{
+		std::vector<uint8_t> data;
+		data.reserve(astNodes.size());
+		for (AstNode * astNode : astNodes)
 		{
-			arrayLiteralString += ", ";
+			if (!astNode->literalValue.IsCharacter())
+			{
+				return false;
+			}
+			data.emplace_back(static_cast<uint8_t>(astNode->literalValue.GetCharacter()));
 		}
+		constant = llvm::ConstantDataArray::get(*m_context, llvm::ArrayRef<uint8_t>(data));
+	}
+	else
+	{
+		return false;
 	}
-	arrayLiteralString += "]";
-	arrayLiteralName = arrayLiteralNode->type + ": " + arrayLiteralString;
+	return true;
 }
 
 bool LLParser::CreateLlvmArrayLiteral()
@@ -1568,25 +2341,31 @@ bool LLParser::CreateLlvmArrayLiteral()
 	if (m_ast[m_ast.size() - i]->children.empty())
 	{
 		SymbolTableRow symbolTableRow;
-		m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(m_ast[m_ast.size() - i]->stringValue), symbolTableRow);
+		GetSymbolTableRowByName(m_ast[m_ast.size() - i]->stringValue, symbolTableRow);
 		arrayLiteralElementType = symbolTableRow.type;
 	}
 	else
 	{
 		arrayLiteralElementType = m_ast[m_ast.size() - i]->children.front()->children.front()->stringValue;
 	}
-	std::vector<llvm::Constant*> arrayLiteralValues;
-	ComputeArrayLiteralValues(m_ast.back()->children, arrayLiteralValues);
-	llvm::ArrayType * arrayType = llvm::ArrayType::get(m_ast.back()->children.front()->llvmValue->getType(), arrayLiteralValues.size());
-
-	llvm::Constant * constant = llvm::ConstantArray::get(arrayType, arrayLiteralValues);
-	if (m_ast[m_ast.size() - 3]->name == "VariableDeclarationA" || m_ast[m_ast.size() - 3]->type == TokenConstant::Name::IDENTIFIER)
+	std::vector<AstNode*> const & arrayLiteralNodes = m_ast.back()->children;
+	AstNode * firstNode = arrayLiteralNodes.front();
+	llvm::Type * elementType = firstNode->llvmValue != nullptr
+		? firstNode->llvmValue->getType()
+		: firstNode->literalValue.IsFloat() ? llvm::Type::getDoubleTy(*m_context) : llvm::Type::getInt32Ty(*m_context);
+	llvm::ArrayType * arrayType = llvm::ArrayType::get(elementType, arrayLiteralNodes.size());
+	llvm::Constant * constant = nullptr;
+	if (!TryToComputeArrayLiteralData(arrayLiteralNodes, elementType, constant))
+	{
+		std::vector<llvm::Constant*> arrayLiteralValues;
+		ComputeArrayLiteralValues(arrayLiteralNodes, arrayLiteralValues);
+		constant = llvm::ConstantArray::get(arrayType, arrayLiteralValues);
+	}
+	bool const isAssigned = m_ast[m_ast.size() - 3]->name == "VariableDeclarationA" || m_ast[m_ast.size() - 3]->type == TokenConstant::Name::IDENTIFIER;
+	// Zero and single-value literals are filled in place, so they do not need a global to copy from
+	if (isAssigned && !IsInDeadCode() && LlvmHelper::GetSplatValue(constant) == nullptr)
 	{
-		std::string arrayLiteralName;
-		ComputeArrayLiteralName(m_ast.back(), arrayLiteralName);
-		llvm::GlobalVariable * globalVariable = new llvm::GlobalVariable(*m_mainBlock->getParent()->getParent(), arrayType, true, llvm::GlobalValue::PrivateLinkage, constant, arrayLiteralName);
-		globalVariable->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
-		m_ast.back()->llvmValue = globalVariable;
+		m_ast.back()->llvmValue = m_constantPool.GetGlobal(constant);
 	}
 	else
 	{
@@ -1599,7 +2378,21 @@ bool LLParser::CreateLlvmArrayLiteral()
 bool LLParser::CreateLlvmIntegerValue()
 {
 	AstNode * astNode = m_ast.back();
-	astNode->llvmValue = LlvmHelper::CreateInteger32Constant(m_context, std::stoi(astNode->stringValue));
+	if (!ParseLiteralValue(astNode, TokenConstant::CoreType::Number::INTEGER))
+	{
+		return false;
+	}
+	if (astNode->literalValue.GetInteger() > std::numeric_limits<int32_t>::max())
+	{
+		PrintErrorMessage("Integer literal \"" + astNode->stringValue + "\" is out of range\n");
+
+		return false;
+	}
+	if (IsArrayLiteralElement())
+	{
+		return true;
+	}
+	astNode->llvmValue = LlvmHelper::CreateInteger32Constant(*m_context, static_cast<int>(astNode->literalValue.GetInteger()));
 
 	return true;
 }
@@ -1607,8 +2400,48 @@ bool LLParser::CreateLlvmIntegerValue()
 bool LLParser::CreateLlvmFloatValue()
 {
 	AstNode * astNode = m_ast.back();
-	astNode->llvmValue = LlvmHelper::CreateFloatConstant(m_context, std::stod(astNode->stringValue));
+	if (!ParseLiteralValue(astNode, TokenConstant::CoreType::Number::FLOAT))
+	{
+		return false;
+	}
+	if (IsArrayLiteralElement())
+	{
+		return true;
+	}
+	astNode->llvmValue = LlvmHelper::CreateFloatConstant(*m_context, astNode->literalValue.GetFloat());
+
+	return true;
+}
+
+bool LLParser::IsArrayLiteralElement() const
+{
+	// Constants of literal list elements are built in bulk by CreateLlvmArrayLiteral.
+	// An element after a comma takes the decision made for the element before it,
+	// so a long list is not scanned again for each element.
+	if (m_ast.size() < 3)
+	{
+		return false;
+	}
+	size_t i = m_ast.size() - 2;
+	if (m_ast[i]->name == "Comma")
+	{
+		return !m_ast[i - 1]->literalValue.IsEmpty() && m_ast[i - 1]->llvmValue == nullptr;
+	}
+	while (i > 0 && m_ast[i]->name == "Left square bracket")
+	{
+		--i;
+	}
+	return i != m_ast.size() - 2 && m_ast[i]->name == "Assignment";
+}
+
+bool LLParser::ParseLiteralValue(AstNode * astNode, std::string const & type)
+{
+	if (!LiteralValue::Parse(type, astNode->stringValue, astNode->literalValue))
+	{
+		PrintErrorMessage("Cannot parse \"" + astNode->stringValue + "\" as " + type + " literal\n");
 
+		return false;
+	}
 	return true;
 }
 
@@ -1618,44 +2451,31 @@ bool LLParser::TryToLoadLlvmValueFromSymbolTable()
 	SymbolTableRow symbolTableRow;
 	if (astNode->stringValue.empty())
 	{
-		m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(astNode->children.front()->stringValue), symbolTableRow);
-		llvm::Type * arrayElementType = LlvmHelper::CreateType(m_context, symbolTableRow.type);
-		if (m_ast.back()->children.back()->children.empty())
-		{
-			std::string variableName = symbolTableRow.name + "[" + m_ast.back()->children.back()->stringValue + "]";
-			llvm::Type * arrayType = LlvmHelper::CreateType(m_context, symbolTableRow.type, std::to_string(symbolTableRow.arrayInformation->dimensions.front()));
-			llvm::Value * index64Bit = m_builder->CreateSExtOrTrunc(m_ast.back()->children.back()->llvmValue, llvm::Type::getInt64Ty(m_context));
-			llvm::Value * inBoundsGetElementPointer = m_builder->CreateInBoundsGEP(arrayType, symbolTableRow.llvmAllocaInst, { LlvmHelper::CreateInteger64Constant(m_context, 0), index64Bit }, "(" + variableName + ")_pointer");
-			astNode->llvmValue = m_builder->CreateLoad(arrayElementType, inBoundsGetElementPointer, "(" + variableName + ")_value");
-		}
-		else
+		GetSymbolTableRowByName(astNode->children.front()->stringValue, symbolTableRow);
+		llvm::Type * arrayElementType = LlvmHelper::CreateType(*m_context, symbolTableRow.type);
+		if (IsInDeadCode())
 		{
-			llvm::Value * inBoundsGetElementPointer = symbolTableRow.llvmAllocaInst;
-			std::string variableName = symbolTableRow.name + "[";
-			for (size_t i = 0; i < m_ast.back()->children.back()->children.size(); ++i)
-			{
-				AstNode * child = m_ast.back()->children.back()->children[i];
-				variableName += child->stringValue;
-				llvm::Type * arrayType = LlvmHelper::CreateType(m_context, symbolTableRow.type);
-				for (size_t j = m_ast.back()->children.back()->children.size() - 1; j != SIZE_MAX + i; --j)
-				{
-					arrayType = llvm::ArrayType::get(arrayType, symbolTableRow.arrayInformation->dimensions[j]);
-				}
-				llvm::Value * index64Bit = m_builder->CreateSExtOrTrunc(child->llvmValue, llvm::Type::getInt64Ty(m_context));
-				inBoundsGetElementPointer = m_builder->CreateInBoundsGEP(arrayType, inBoundsGetElementPointer, { LlvmHelper::CreateInteger64Constant(m_context, 0), index64Bit }, "(" + variableName + "])_pointer");
-				if (i < m_ast.back()->children.back()->children.size() - 1)
-				{
-					variableName += ", ";
-				}
-			}
-			astNode->llvmValue = m_builder->CreateLoad(arrayElementType, inBoundsGetElementPointer, "(" + variableName + ")_value");
+			astNode->llvmValue = llvm::UndefValue::get(arrayElementType);
+
+			return true;
 		}
+		std::string elementName;
+		llvm::Value * inBoundsGetElementPointer = CreateArrayElementPointer(symbolTableRow, astNode->children.back(), elementName);
+		astNode->llvmValue = m_builder->CreateLoad(arrayElementType, inBoundsGetElementPointer, elementName.empty() ? "" : elementName + "_value");
 	}
 	else
 	{
-		m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(astNode->stringValue), symbolTableRow);
+		GetSymbolTableRowByName(astNode->stringValue, symbolTableRow);
 		astNode->computedType = symbolTableRow.type;
-		astNode->llvmValue = m_builder->CreateLoad(symbolTableRow.llvmAllocaInst, symbolTableRow.name + "_value");
+		if (IsInDeadCode())
+		{
+			astNode->llvmValue = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, symbolTableRow.type));
+
+			return true;
+		}
+		astNode->llvmValue = symbolTableRow.llvmPointer == nullptr
+			? ReadSsaVariable(FindRowIndexInScopeByName(astNode->stringValue), symbolTableRow.type)
+			: m_builder->CreateLoad(symbolTableRow.llvmPointer, symbolTableRow.name + "_value");
 	}
 
 	return true;
@@ -1665,13 +2485,53 @@ bool LLParser::TryToReferenceLlvmValueFromSymbolTable()
 {
 	AstNode * astNode = m_ast.back();
 	SymbolTableRow symbolTableRow;
-	m_symbolTable.GetSymbolTableRowByRowIndex(FindRowIndexInScopeByName(astNode->stringValue), symbolTableRow);
+	GetSymbolTableRowByName(astNode->stringValue, symbolTableRow);
 	astNode->computedType = symbolTableRow.type;
-	astNode->llvmValue = symbolTableRow.llvmAllocaInst;
+	astNode->llvmValue = symbolTableRow.llvmPointer;
+	if (IsInDeadCode())
+	{
+		astNode->llvmValue = llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, symbolTableRow.type)->getPointerTo());
+	}
+	else if (symbolTableRow.llvmPointer == nullptr)
+	{
+		// Scanf needs an address, so an SSA variable is read through a temporary slot written back after the call
+		unsigned int const rowIndex = FindRowIndexInScopeByName(astNode->stringValue);
+		auto * slot = llvm::cast<llvm::AllocaInst>(AllocateVariable(LlvmHelper::CreateType(*m_context, symbolTableRow.type), symbolTableRow.name + "_read"));
+		m_builder->CreateStore(ReadSsaVariable(rowIndex, symbolTableRow.type), slot);
+		m_readSlots.emplace_back(rowIndex, slot);
+		astNode->llvmValue = slot;
+	}
 
 	return true;
 }
 
+llvm::Value * LLParser::ReadSsaVariable(unsigned int rowIndex, std::string const & type)
+{
+	if (IsInDeadCode())
+	{
+		return llvm::UndefValue::get(LlvmHelper::CreateType(*m_context, type));
+	}
+	return m_ssaBuilder.ReadVariable(rowIndex, m_builder->GetInsertBlock());
+}
+
+void LLParser::WriteSsaVariable(unsigned int rowIndex, std::string const & type, llvm::Value * value)
+{
+	if (IsInDeadCode())
+	{
+		return;
+	}
+	value = LlvmHelper::ConvertToType(m_builder, value, LlvmHelper::CreateType(*m_context, type));
+	m_ssaBuilder.WriteVariable(rowIndex, m_builder->GetInsertBlock(), value);
+}
+
+void LLParser::SealBlock(llvm::BasicBlock * block)
+{
+	if (block != nullptr)
+	{
+		m_ssaBuilder.SealBlock(block);
+	}
+}
+
 bool LLParser::RemoveComma()
 {
 	std::vector<AstNode*> & identifierListChildren = m_ast.back()->children;
@@ -1695,41 +2555,77 @@ bool LLParser::RemovePredefinedFunctionReadOrWriteExtra()
 
 bool LLParser::CreateLlvmReadFunction()
 {
+	if (IsInDeadCode())
+	{
+		return true;
+	}
 	std::vector<AstNode*> & functionParameters = m_ast.back()->children;
 	std::vector<llvm::Value *> arguments;
 	for (AstNode * functionParameter : functionParameters)
 	{
 		arguments.emplace_back(functionParameter->llvmValue);
 	}
-	m_builder->CreateCall(LLParser::ScanfPrototype(m_context, m_module.get()), arguments);
+	m_builder->CreateCall(ScanfPrototype(), arguments);
+	for (std::pair<unsigned int, llvm::AllocaInst *> const & readSlot : m_readSlots)
+	{
+		SymbolTableRow symbolTableRow;
+		m_symbolTable.GetSymbolTableRowByRowIndex(readSlot.first, symbolTableRow);
+		WriteSsaVariable(readSlot.first, symbolTableRow.type, m_builder->CreateLoad(readSlot.second, symbolTableRow.name + "_value"));
+		ReleaseVariable(readSlot.second);
+	}
+	m_readSlots.clear();
 
 	return true;
 }
 
 bool LLParser::CreateLlvmWriteFunction()
 {
+	if (IsInDeadCode())
+	{
+		return true;
+	}
 	std::vector<AstNode*> & functionParameters = m_ast.back()->children;
 	std::vector<llvm::Value *> arguments;
 	for (AstNode * functionParameter : functionParameters)
 	{
 		arguments.emplace_back(functionParameter->llvmValue);
 	}
-	m_builder->CreateCall(LLParser::PrintfPrototype(m_context, m_module.get()), arguments);
+	m_builder->CreateCall(PrintfPrototype(), arguments);
 
 	return true;
 }
 
 bool LLParser::CreateLlvmArrayAssignFunction(llvm::Value * allocaInst, std::string const & variableName, llvm::Type * variableType, int arraySize)
 {
-	llvm::Value * bitcasted = m_builder->CreateBitCast(allocaInst, llvm::Type::getInt8PtrTy(m_context), "(" + variableName + ")" + "_pointer_bitcasted");
-	std::vector<llvm::Value*> arguments {
-		bitcasted,
-		m_builder->CreateBitCast(m_ast.back()->llvmValue, llvm::Type::getInt8PtrTy(m_context)),
-		LlvmHelper::CreateInteger64Constant(m_context, m_dataLayout->getTypeAllocSize(variableType) * arraySize),
-		LlvmHelper::CreateBooleanConstant(m_context, false)
-	};
+	if (IsInDeadCode())
+	{
+		return true;
+	}
+	llvm::Value * source = m_ast.back()->llvmValue;
+	unsigned const alignment = m_dataLayout->getABITypeAlignment(variableType);
+	uint64_t const size = m_dataLayout->getTypeAllocSize(variableType) * arraySize;
+	llvm::Value * bitcasted = m_builder->CreateBitCast(allocaInst, llvm::Type::getInt8PtrTy(*m_context), "(" + variableName + ")" + "_pointer_bitcasted");
+	if (!llvm::isa<llvm::Constant>(source) || llvm::isa<llvm::GlobalVariable>(source))
+	{
+		m_builder->CreateMemCpy(bitcasted, alignment, m_builder->CreateBitCast(source, llvm::Type::getInt8PtrTy(*m_context)), alignment, size);
 
-	m_builder->CreateCall(LLParser::MemcpyPrototype(m_context, m_module.get()), arguments);
+		return true;
+	}
+	llvm::Constant * splatValue = llvm::cast<llvm::Constant>(
+		LlvmHelper::ConvertToType(m_builder, LlvmHelper::GetSplatValue(llvm::cast<llvm::Constant>(source)), variableType));
+	if (llvm::Value * byteValue = llvm::isBytewiseValue(splatValue, *m_dataLayout))
+	{
+		m_builder->CreateMemSet(bitcasted, byteValue, size, alignment);
+	}
+	else
+	{
+		std::vector<llvm::Value*> arguments {
+			m_builder->CreateBitCast(allocaInst, variableType->getPointerTo()),
+			splatValue,
+			LlvmHelper::CreateInteger64Constant(*m_context, arraySize)
+		};
+		m_builder->CreateCall(FillPrototype(variableType), arguments);
+	}
 
 	return true;
 }
@@ -1760,20 +2656,37 @@ bool LLParser::RemoveIfOrWhileStatementExtra()
 
 bool LLParser::CreateIfStatement()
 {
+	if (IsInDeadCode())
+	{
+		m_blocksTrue.push(nullptr);
+		m_blocksFalse.push(nullptr);
+
+		return true;
+	}
 	llvm::Value * condition = CreateCondition("if condition");
-	llvm::BasicBlock * blockTrue = llvm::BasicBlock::Create(m_context, "block true", m_mainFunction);
-	llvm::BasicBlock * blockFalse = llvm::BasicBlock::Create(m_context, "block false", m_mainFunction);
+	if (auto * constantCondition = llvm::dyn_cast<llvm::ConstantInt>(condition))
+	{
+		llvm::BasicBlock * currentBlock = m_builder->GetInsertBlock();
+		m_blocksTrue.push(constantCondition->isOne() ? currentBlock : nullptr);
+		m_blocksFalse.push(constantCondition->isOne() ? nullptr : currentBlock);
+
+		return true;
+	}
+	llvm::BasicBlock * blockTrue = llvm::BasicBlock::Create(*m_context, "block true", m_mainFunction);
+	llvm::BasicBlock * blockFalse = llvm::BasicBlock::Create(*m_context, "block false", m_mainFunction);
 	m_blocksTrue.push(blockTrue);
 	m_blocksFalse.push(blockFalse);
 
 	m_builder->CreateCondBr(condition, blockTrue, blockFalse);
+	SealBlock(blockTrue);
+	SealBlock(blockFalse);
 
 	return true;
 }
 
 bool LLParser::StartBlockTrue()
 {
-	m_builder->SetInsertPoint(m_blocksTrue.top());
+	StartBlock(m_blocksTrue.top());
 	m_blocksTrue.pop();
 
 	return true;
@@ -1781,7 +2694,7 @@ bool LLParser::StartBlockTrue()
 
 bool LLParser::StartBlockFalse()
 {
-	m_builder->SetInsertPoint(m_blocksFalse.top());
+	StartBlock(m_blocksFalse.top());
 	m_blocksFalse.pop();
 
 	return true;
@@ -1789,14 +2702,18 @@ bool LLParser::StartBlockFalse()
 
 bool LLParser::GotoPostIfStatementLabel()
 {
-	m_builder->CreateBr(m_previousBlocks.top());
+	if (!IsInDeadCode())
+	{
+		m_builder->CreateBr(m_previousBlocks.top());
+	}
 
 	return true;
 }
 
 bool LLParser::StartBlockPrevious()
 {
-	m_builder->SetInsertPoint(m_previousBlocks.top());
+	SealBlock(m_previousBlocks.top());
+	StartBlock(m_previousBlocks.top());
 	m_previousBlocks.pop();
 
 	return true;
@@ -1811,7 +2728,9 @@ bool LLParser::SynthesisIfOrWhileCondition()
 
 bool LLParser::CreateBlockWhile()
 {
-	llvm::BasicBlock * blockWhileStatement = llvm::BasicBlock::Create(m_context, "while", m_mainFunction);
+	llvm::BasicBlock * blockWhileStatement = IsInDeadCode()
+		? nullptr
+		: llvm::BasicBlock::Create(*m_context, "while", m_mainFunction);
 	m_whileBlocks.push(blockWhileStatement);
 
 	return true;
@@ -1819,18 +2738,40 @@ bool LLParser::CreateBlockWhile()
 
 bool LLParser::CreateWhileStatement()
 {
+	if (IsInDeadCode())
+	{
+		m_previousBlocks.push(nullptr);
+
+		return true;
+	}
 	llvm::Value * condition = CreateCondition("while condition");
-	llvm::BasicBlock * blockPostWhile = llvm::BasicBlock::Create(m_context, "post while", m_mainFunction);
+	llvm::BasicBlock * blockPostWhile = llvm::BasicBlock::Create(*m_context, "post while", m_mainFunction);
 	m_previousBlocks.push(blockPostWhile);
+	if (auto * constantCondition = llvm::dyn_cast<llvm::ConstantInt>(condition))
+	{
+		if (constantCondition->isOne())
+		{
+			m_builder->CreateBr(m_whileBlocks.top());
+			SealBlock(m_whileBlocks.top());
+		}
+		else
+		{
+			m_whileBlocks.top()->eraseFromParent();
+			m_whileBlocks.top() = nullptr;
+			m_builder->CreateBr(blockPostWhile);
+		}
+		return true;
+	}
 
 	m_builder->CreateCondBr(condition, m_whileBlocks.top(), blockPostWhile);
+	SealBlock(m_whileBlocks.top());
 
 	return true;
 }
 
 bool LLParser::StartBlockWhile()
 {
-	m_builder->SetInsertPoint(m_whileBlocks.top());
+	StartBlock(m_whileBlocks.top());
 	m_whileBlocks.pop();
 
 	return true;
@@ -1838,7 +2779,9 @@ bool LLParser::StartBlockWhile()
 
 bool LLParser::CreateBlockPreWhile()
 {
-	llvm::BasicBlock * blockPreWhileStatement = llvm::BasicBlock::Create(m_context, "pre while", m_mainFunction);
+	llvm::BasicBlock * blockPreWhileStatement = IsInDeadCode()
+		? nullptr
+		: llvm::BasicBlock::Create(*m_context, "pre while", m_mainFunction);
 	m_preWhileBlocks.push(blockPreWhileStatement);
 
 	return true;
@@ -1846,14 +2789,17 @@ bool LLParser::CreateBlockPreWhile()
 
 bool LLParser::GotoBlockPreWhile()
 {
-	m_builder->CreateBr(m_preWhileBlocks.top());
+	if (!IsInDeadCode())
+	{
+		m_builder->CreateBr(m_preWhileBlocks.top());
+	}
 
 	return true;
 }
 
 bool LLParser::StartBlockPreWhile()
 {
-	m_builder->SetInsertPoint(m_preWhileBlocks.top());
+	StartBlock(m_preWhileBlocks.top());
 
 	return true;
 }
@@ -1868,14 +2814,35 @@ bool LLParser::SynthesisIfOrWhileConditionAndRemoveEmptyElse()
 
 bool LLParser::SavePostIfStatementToPreviousBlocks()
 {
-	llvm::BasicBlock * blockPostIfStatement = llvm::BasicBlock::Create(m_context, "post if statement", m_mainFunction);
+	llvm::BasicBlock * blockPostIfStatement = IsInDeadCode()
+		? nullptr
+		: llvm::BasicBlock::Create(*m_context, "post if statement", m_mainFunction);
 	m_previousBlocks.push(blockPostIfStatement);
 
 	return true;
 }
 
+void LLParser::StartBlock(llvm::BasicBlock * block)
+{
+	// A dead branch has no block, so its actions must not emit anything until a live block starts again
+	m_isInDeadCode = block == nullptr;
+	if (m_isInDeadCode)
+	{
+		m_builder->ClearInsertionPoint();
+
+		return;
+	}
+	m_builder->SetInsertPoint(block);
+}
+
+bool LLParser::IsInDeadCode() const
+{
+	return m_isInDeadCode;
+}
+
 bool LLParser::EndBlockPreWhile()
 {
+	SealBlock(m_preWhileBlocks.top());
 	m_preWhileBlocks.pop();
 
 	return true;
@@ -1911,16 +2878,34 @@ bool LLParser::abc()
 
 void LLParser::PrintColoredMessage(std::string const & message, std::string const & colorCode) const
 {
-	std::cout << "\033[" + colorCode + "m";
-	std::cout << message;
-	std::cout << "\033[m";
+	if (m_compileOptions.diagnosticOutput == nullptr)
+	{
+		return;
+	}
+	std::ostream & output = *m_compileOptions.diagnosticOutput;
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[" + colorCode + "m";
+	}
+	output << message;
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[m";
+	}
 }
 
 void LLParser::PrintTokenInformations(
-	std::vector<TokenInformation> const & tokenInformations, size_t from, size_t to, std::string const & color
-)
+	std::ostream & output,
+	std::vector<TokenInformation> const & tokenInformations,
+	size_t from,
+	size_t to,
+	std::string const & color
+) const
 {
-	std::cout << "\033[" + color + "m";
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[" + color + "m";
+	}
 	StreamPosition outputStreamPosition;
 	if (from > 0)
 	{
@@ -1941,21 +2926,21 @@ void LLParser::PrintTokenInformations(
 		long const & column = streamPosition.GetColumn();
 		while (line > outputStreamPosition.GetLine())
 		{
-			std::cout << "\n";
+			output << "\n";
 			outputStreamPosition.IncreaseLine();
 			outputStreamPosition.SetColumn(1);
 		}
 		char const indentCharacter = outputStreamPosition.GetColumn() == 1 ? '\t' : ' ';
 		while (column > outputStreamPosition.GetColumn())
 		{
-			std::cout << indentCharacter;
+			output << indentCharacter;
 			outputStreamPosition.IncreaseColumn();
 		}
 		for (
 			char ch : streamStringString
 				)
 		{
-			std::cout << ch;
+			output << ch;
 			if (ch == '\n' || ch == '\r')
 			{
 				outputStreamPosition.IncreaseLine();
@@ -1967,7 +2952,10 @@ void LLParser::PrintTokenInformations(
 			}
 		}
 	}
-	std::cout << "\033[m";
+	if (m_compileOptions.decorateOutput)
+	{
+		output << "\033[m";
+	}
 }
 
 void LLParser::PrintWarningMessage(std::string const & message) const
@@ -2042,14 +3030,15 @@ return lhs == TokenConstant::Operator::Assignment::ASSIGNMENT
 	|| lhs == TokenConstant::Parentheses::ROUND_BRACKET.LEFT;
 }
 
-AstNode * LLParser::CreateLiteralAstNode(std::string const & type, std::string const & value)
+AstNode * LLParser::CreateLiteralAstNode(std::string const & type, LiteralValue const & value)
 {
-	AstNode * result = new AstNode();
+	AstNode * result = AllocateAstNode();
 	result->name = type;
 	result->type = type;
 	result->computedType = type;
-	result->stringValue = value;
-	result->llvmValue = LlvmHelper::CreateConstant(m_context, type, value);
+	result->stringValue = value.ToString();
+	result->literalValue = value;
+	result->llvmValue = LlvmHelper::CreateConstant(*m_context, type, value);
 
 	return result;
 }
@@ -2057,54 +3046,133 @@ AstNode * LLParser::CreateLiteralAstNode(std::string const & type, std::string c
 llvm::Value * LLParser::CreateCondition(std::string const & name)
 {
 	AstNode * expressionNode = m_ast[m_ast.size() - 2];
-
-	llvm::Value * expression = expressionNode->llvmValue;
-	if (expressionNode->computedType == TokenConstant::CoreType::Number::INTEGER)
+	std::string const & type = expressionNode->computedType;
+	if (type != TokenConstant::CoreType::Number::INTEGER
+		&& type != TokenConstant::CoreType::Number::FLOAT
+		&& type != TokenConstant::CoreType::BOOLEAN)
 	{
-		expression = LlvmHelper::ConvertToFloat(m_builder, expression);
+		throw std::runtime_error("LLParser::CreateCondition: Unsupported type in expression \"" + type + "\"");
 	}
-	else if (expressionNode->computedType == TokenConstant::CoreType::BOOLEAN)
+	return LlvmHelper::CreateCondition(m_builder, expressionNode->llvmValue, name);
+}
+
+void LLParser::CreateModule(std::string const & moduleName, std::string const & functionName)
+{
+	m_isInDeadCode = false;
+	m_module = std::make_unique<llvm::Module>(moduleName, *m_context);
+	m_dataLayout = std::make_unique<llvm::DataLayout>(m_module.get());
+	std::vector<llvm::Type *> mainFunctionArgumentsTypes;
+	m_mainFunctionType = llvm::FunctionType::get(llvm::Type::getInt32Ty(*m_context), mainFunctionArgumentsTypes, false);
+	m_mainFunction = llvm::Function::Create(m_mainFunctionType, llvm::GlobalValue::ExternalLinkage, functionName, m_module.get());
+	m_mainBlock = llvm::BasicBlock::Create(*m_context, "main block", m_mainFunction, nullptr);
+	m_builder->SetInsertPoint(m_mainBlock);
+	m_stackAllocator.Reset(m_mainBlock);
+	m_ssaBuilder.Reset();
+	m_constantPool.Reset(m_module.get());
+	m_ssaBuilder.SealBlock(m_mainBlock);
+	m_readSlots.clear();
+	m_heapVariables.clear();
+	m_previousBlocks.push(m_mainBlock);
+	m_printfFunction = nullptr;
+	m_scanfFunction = nullptr;
+	m_callocFunction = nullptr;
+	m_freeFunction = nullptr;
+	m_fillFunctions.clear();
+}
+
+AstNode * LLParser::AllocateAstNode()
+{
+	if (m_usedAstNodeCount == m_astNodes.size())
 	{
-		expression = LlvmHelper::ConvertToFloat(m_builder, expression);
+		m_astNodes.emplace_back(std::make_unique<AstNode>());
 	}
-	else if (expressionNode->computedType != TokenConstant::CoreType::Number::FLOAT)
+	else
 	{
-		throw std::runtime_error("LLParser::CreateIfStatement: Unsupported type in expression \"" + expressionNode->computedType + "\"");
+		m_astNodes[m_usedAstNodeCount]->Clear();
 	}
-	return m_builder->CreateFCmpONE(expression, LlvmHelper::CreateFloatConstant(m_context, 0.0), name);
+	return m_astNodes[m_usedAstNodeCount++].get();
 }
 
-llvm::Function * LLParser::PrintfPrototype(llvm::LLVMContext & context, llvm::Module * module)
+llvm::Function * LLParser::PrintfPrototype()
 {
-	static std::vector<llvm::Type *> argumentsTypes { llvm::Type::getInt8PtrTy(context) };
-	static llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getInt32Ty(context), argumentsTypes, true);
-	static llvm::Function * result = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "printf", module);
-	result->setCallingConv(llvm::CallingConv::C);
+	if (m_printfFunction == nullptr)
+	{
+		std::vector<llvm::Type *> argumentsTypes { llvm::Type::getInt8PtrTy(*m_context) };
+		llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getInt32Ty(*m_context), argumentsTypes, true);
+		m_printfFunction = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "printf", m_module.get());
+		m_printfFunction->setCallingConv(llvm::CallingConv::C);
+	}
+	return m_printfFunction;
+}
 
-	return result;
+llvm::Function * LLParser::ScanfPrototype()
+{
+	if (m_scanfFunction == nullptr)
+	{
+		std::vector<llvm::Type *> argumentsTypes { llvm::Type::getInt8PtrTy(*m_context) };
+		llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getInt32Ty(*m_context), argumentsTypes, true);
+		m_scanfFunction = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "scanf", m_module.get());
+		m_scanfFunction->setCallingConv(llvm::CallingConv::C);
+	}
+	return m_scanfFunction;
 }
 
-llvm::Function * LLParser::ScanfPrototype(llvm::LLVMContext & context, llvm::Module * module)
+llvm::Function * LLParser::CallocPrototype()
 {
-	static std::vector<llvm::Type *> argumentsTypes { llvm::Type::getInt8PtrTy(context) };
-	static llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getInt32Ty(context), argumentsTypes, true);
-	static llvm::Function * result = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "scanf", module);
-	result->setCallingConv(llvm::CallingConv::C);
+	if (m_callocFunction == nullptr)
+	{
+		std::vector<llvm::Type *> argumentsTypes { llvm::Type::getInt64Ty(*m_context), llvm::Type::getInt64Ty(*m_context) };
+		llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getInt8PtrTy(*m_context), argumentsTypes, false);
+		m_callocFunction = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "calloc", m_module.get());
+		m_callocFunction->setCallingConv(llvm::CallingConv::C);
+	}
+	return m_callocFunction;
+}
 
-	return result;
+llvm::Function * LLParser::FreePrototype()
+{
+	if (m_freeFunction == nullptr)
+	{
+		std::vector<llvm::Type *> argumentsTypes { llvm::Type::getInt8PtrTy(*m_context) };
+		llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getVoidTy(*m_context), argumentsTypes, false);
+		m_freeFunction = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "free", m_module.get());
+		m_freeFunction->setCallingConv(llvm::CallingConv::C);
+	}
+	return m_freeFunction;
 }
 
-llvm::Function * LLParser::MemcpyPrototype(llvm::LLVMContext & context, llvm::Module * module)
+llvm::Function * LLParser::FillPrototype(llvm::Type * elementType)
 {
-	static std::vector<llvm::Type *> argumentsTypes {
-		llvm::Type::getInt8PtrTy(context),
-		llvm::Type::getInt8PtrTy(context),
-		llvm::Type::getInt64Ty(context),
-		llvm::Type::getInt1Ty(context)
-	};
-	static llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getVoidTy(context), argumentsTypes, false);
-	static llvm::Function * result = llvm::Function::Create(type, llvm::Function::ExternalLinkage, "memcpy", module);
-	result->setCallingConv(llvm::CallingConv::C);
+	llvm::Function *& fillFunction = m_fillFunctions[elementType];
+	if (fillFunction == nullptr)
+	{
+		std::vector<llvm::Type *> argumentsTypes {
+			elementType->getPointerTo(),
+			elementType,
+			llvm::Type::getInt64Ty(*m_context)
+		};
+		llvm::FunctionType * type = llvm::FunctionType::get(llvm::Type::getVoidTy(*m_context), argumentsTypes, false);
+		fillFunction = llvm::Function::Create(type, llvm::Function::PrivateLinkage, "fill", m_module.get());
+		fillFunction->addFnAttr(llvm::Attribute::AlwaysInline);
+		llvm::Function::arg_iterator arguments = fillFunction->arg_begin();
+		llvm::Value * destination = &*arguments++;
+		llvm::Value * value = &*arguments++;
+		llvm::Value * count = &*arguments;
 
-	return result;
+		llvm::BasicBlock * entryBlock = llvm::BasicBlock::Create(*m_context, "entry", fillFunction);
+		llvm::BasicBlock * loopBlock = llvm::BasicBlock::Create(*m_context, "loop", fillFunction);
+		llvm::BasicBlock * exitBlock = llvm::BasicBlock::Create(*m_context, "exit", fillFunction);
+		llvm::IRBuilder<> builder(entryBlock);
+		builder.CreateCondBr(builder.CreateICmpEQ(count, builder.getInt64(0)), exitBlock, loopBlock);
+		builder.SetInsertPoint(loopBlock);
+		llvm::PHINode * index = builder.CreatePHI(builder.getInt64Ty(), 2, "index");
+		index->addIncoming(builder.getInt64(0), entryBlock);
+		builder.CreateStore(value, builder.CreateInBoundsGEP(elementType, destination, index));
+		llvm::Value * nextIndex = builder.CreateNUWAdd(index, builder.getInt64(1), "next_index");
+		index->addIncoming(nextIndex, loopBlock);
+		builder.CreateCondBr(builder.CreateICmpEQ(nextIndex, count), exitBlock, loopBlock);
+		builder.SetInsertPoint(exitBlock);
+		builder.CreateRetVoid();
+	}
+	return fillFunction;
 }
@@ -4,21 +4,50 @@
 #include "LLTableBuilderLibrary/LLTableBuilder.h"
 #include "AstNode/AstNode.h"
 #include "SymbolTable/SymbolTable.h"
+#include "ParserState/ParserState.h"
+#include "CompileOptions/CompileOptions.h"
+#include "SyntaxValidator/SyntaxValidator.h"
+#include "ThreadPool/ThreadPool.h"
+#include "CompilerSession/CompilerSession.h"
+#include "CompileResult/CompileResult.h"
+#include "CompileCache/CompileCache.h"
+#include "StackAllocator/StackAllocator.h"
+#include "SsaBuilder/SsaBuilder.h"
+#include "ConstantPool/ConstantPool.h"
 #include "LexerLibrary/TokenLibrary/Token.h"
 #include "LLTableBuilderLibrary/TokenLibrary/TokenExtensions/TokenExtensions.h"
 #include <unordered_set>
 #include <unordered_map>
 #include <stack>
+#include <memory>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Value.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 
 class TokenInformation;
+class TableRow;
 
 class LLParser
 {
 public:
 	explicit LLParser(std::string const & ruleFileName);
+	explicit LLParser(std::shared_ptr<LLTableBuilder> llTableBuilder);
+
+	void SetCompileOptions(CompileOptions const & compileOptions);
+	void SetCompileCache(std::shared_ptr<CompileCache> compileCache);
+	bool CompileReplInput(
+		std::vector<TokenInformation> const & tokenInformations,
+		std::string const & functionName,
+		std::unique_ptr<llvm::Module> & module
+	);
+	void RollBackReplInput();
+	std::vector<std::string> const & GetReplInputGlobalNames() const;
+	bool GetReplGlobal(std::string const & name, SymbolTableRow & result) const;
+	bool DetachReplGlobal(std::string const & name, unsigned int & rowIndex);
+	void AttachReplGlobal(std::string const & name, unsigned int rowIndex);
+	llvm::orc::ThreadSafeContext const & GetThreadSafeContext() const;
+	void Reset();
 
 	bool IsValid(
 		std::string const & inputFileName,
@@ -27,7 +56,35 @@ public:
 		std::unordered_set<Token> & expectedWords
 	);
 
+	bool ValidateSyntax(
+		std::string const & inputFileName,
+		std::vector<TokenInformation> & tokenInformations,
+		std::vector<SyntaxError> & syntaxErrors
+	);
+
+	void StartParsing();
+	ParseStatus Feed(TokenInformation const & tokenInformation);
+	ParseStatus Feed(std::vector<TokenInformation> const & tokenInformations);
+	bool Finish();
+	ParserState const & GetParserState() const;
+
+	CompileResult const & GetCompileResult() const;
+	bool Execute(int & exitCode);
+	bool Emit(EmissionKind emissionKind, llvm::raw_pwrite_stream & output);
+	bool Emit(EmissionKind emissionKind, std::unique_ptr<llvm::MemoryBuffer> & buffer);
+
 private:
+	ParseStatus Advance();
+	bool GotoNextRow(TableRow const * currentRow);
+	void PushTokenAstNode(TokenInformation const & tokenInformation);
+	std::function<bool(TokenInformation &)> CreateTokenSource(std::string const & inputFileName) const;
+	void CompleteCompilation();
+	void PrintRecode(std::ostream & output) const;
+	void PrintIr(llvm::raw_ostream & output) const;
+	void EmitObjectFile(std::string const & objectFileName);
+	bool PrepareCompilerSession();
+	bool LoadCachedModule();
+
 	AstNode * CreateAstNode(std::string const & ruleName, unsigned int tokenCount);
 
 	bool TryToCreateAstNode(std::string const & actionName);
@@ -36,13 +93,22 @@ private:
 	bool ResolveActionName(std::string const & actionName) const;
 	bool ResolveAstActionName(std::string const & actionName);
 
+	bool GetSymbolTableRowByName(std::string const & name, SymbolTableRow & result) const;
+	std::string CreateGlobalName(std::string const & variableName) const;
 	unsigned int FindRowIndexInScopeByName(std::string const & name) const;
 
 	bool CreateScopeAction();
 	bool DestroyScopeAction();
 	void ComputeDimensions(AstNode * extendedType, std::vector<unsigned int> & dimensions);
 	bool AddVariableToScope();
+	llvm::Value * AllocateVariable(llvm::Type * type, std::string const & name);
+	llvm::Value * AllocateHeapVariable(llvm::Type * type, std::string const & name);
+	void ReleaseVariable(llvm::Value * llvmPointer);
+	llvm::Value * ReadSsaVariable(unsigned int rowIndex, std::string const & type);
+	void WriteSsaVariable(unsigned int rowIndex, std::string const & type, llvm::Value * value);
+	void SealBlock(llvm::BasicBlock * block);
 	bool UpdateVariableInScope();
+	llvm::Value * CreateArrayElementPointer(SymbolTableRow const & symbolTableRow, AstNode * indicesNode, std::string & elementName);
 	bool CheckIdentifierForAlreadyExisting() const;
 	bool CheckIdentifierForExisting();
 	bool Synthesis();
@@ -91,6 +157,8 @@ private:
 	bool SynthesisIfOrWhileConditionAndRemoveEmptyElse();
 	bool SavePostIfStatementToPreviousBlocks();
 	bool EndBlockPreWhile();
+	void StartBlock(llvm::BasicBlock * block);
+	bool IsInDeadCode() const;
 	bool ExpandArrayLiteral();
 	bool SynthesisIdentifierPossibleArrayAccessing();
 	bool abc();
@@ -99,28 +167,39 @@ private:
 	bool CreateLlvmCharacterLiteral();
 	bool CreateLlvmBooleanLiteral();
 	void ComputeArrayLiteralValues(std::vector<AstNode*> const & astNodes, std::vector<llvm::Constant*> & arrayLiteralValues);
-	void ComputeArrayLiteralName(AstNode * arrayLiteralNode, std::string & arrayLiteralName);
+	bool TryToComputeArrayLiteralData(std::vector<AstNode*> const & astNodes, llvm::Type * elementType, llvm::Constant *& constant);
 	bool CreateLlvmArrayLiteral();
 	bool CreateLlvmIntegerValue();
 	bool CreateLlvmFloatValue();
+	bool IsArrayLiteralElement() const;
 	bool TryToLoadLlvmValueFromSymbolTable();
 	bool TryToReferenceLlvmValueFromSymbolTable();
 
 	void PrintTokenInformations(
-		std::vector<TokenInformation> const & tokenInformations, size_t from, size_t to, std::string const & color
-	);
+		std::ostream & output,
+		std::vector<TokenInformation> const & tokenInformations,
+		size_t from,
+		size_t to,
+		std::string const & color
+	) const;
 	void PrintColoredMessage(std::string const & message, std::string const & colorCode) const;
 	void PrintWarningMessage(std::string const & message) const;
 	void PrintErrorMessage(std::string const & message) const;
 
 	bool AreTypesCompatible(std::string const & lhsType, std::string const & rhsType, std::string & resultType);
 	bool IsUnaryMinus(std::string const & lhs);
-	AstNode * CreateLiteralAstNode(std::string const & type, std::string const & value);
+	AstNode * CreateLiteralAstNode(std::string const & type, LiteralValue const & value);
+	bool ParseLiteralValue(AstNode * astNode, std::string const & type);
 	llvm::Value * CreateCondition(std::string const & name);
 
-	static llvm::Function * PrintfPrototype(llvm::LLVMContext & context, llvm::Module * module);
-	static llvm::Function * ScanfPrototype(llvm::LLVMContext & context, llvm::Module * module);
-	static llvm::Function * MemcpyPrototype(llvm::LLVMContext & context, llvm::Module * module);
+	void CreateModule(std::string const & moduleName, std::string const & functionName);
+	AstNode * AllocateAstNode();
+
+	llvm::Function * PrintfPrototype();
+	llvm::Function * ScanfPrototype();
+	llvm::Function * CallocPrototype();
+	llvm::Function * FreePrototype();
+	llvm::Function * FillPrototype(llvm::Type * elementType);
 
 	std::unordered_map<std::string, std::function<bool()>> const ACTION_NAME_TO_ACTION_MAP {
 		{ "Create scope", std::bind(&LLParser::CreateScopeAction, this) },
@@ -566,22 +645,46 @@ private:
 		{ TokenConstant::CoreType::Complex::ARRAY, { TokenConstant::Name::ARRAY_LITERAL }}
 	};
 
-	LLTableBuilder m_llTableBuilder;
+	std::shared_ptr<LLTableBuilder> m_llTableBuilder;
+	ParserState m_parserState;
 	std::vector<AstNode *> m_ast;
+	std::vector<std::unique_ptr<AstNode>> m_astNodes;
+	size_t m_usedAstNodeCount = 0;
 	std::vector<std::unordered_map<std::string, unsigned int>> m_scopes {{ }};
 	SymbolTable m_symbolTable;
-	llvm::LLVMContext m_context;
+	llvm::orc::ThreadSafeContext m_threadSafeContext { std::make_unique<llvm::LLVMContext>() };
+	llvm::LLVMContext * m_context = m_threadSafeContext.getContext();
 	std::unique_ptr<llvm::Module> m_module;
 	llvm::FunctionType * m_mainFunctionType;
 	llvm::Function * m_mainFunction;
 	llvm::BasicBlock * m_mainBlock;
 	llvm::IRBuilder<> * m_builder;
+	StackAllocator m_stackAllocator;
+	SsaBuilder m_ssaBuilder;
+	ConstantPool m_constantPool;
+	std::vector<std::pair<unsigned int, llvm::AllocaInst *>> m_readSlots;
+	std::unordered_set<llvm::Value *> m_heapVariables;
 	std::unique_ptr<llvm::DataLayout> m_dataLayout;
+	llvm::Function * m_printfFunction = nullptr;
+	llvm::Function * m_scanfFunction = nullptr;
+	llvm::Function * m_callocFunction = nullptr;
+	llvm::Function * m_freeFunction = nullptr;
+	std::unordered_map<llvm::Type*, llvm::Function*> m_fillFunctions;
 	std::stack<llvm::BasicBlock*> m_preWhileBlocks;
 	std::stack<llvm::BasicBlock*> m_whileBlocks;
 	std::stack<llvm::BasicBlock*> m_blocksTrue;
 	std::stack<llvm::BasicBlock*> m_blocksFalse;
 	std::stack<llvm::BasicBlock*> m_previousBlocks;
+	bool m_isInDeadCode = false;
+	CompileOptions m_compileOptions;
+	std::unique_ptr<ThreadPool> m_threadPool;
+	std::unique_ptr<CompilerSession> m_compilerSession;
+	CompileResult m_compileResult;
+	std::shared_ptr<CompileCache> m_compileCache;
+	std::string m_cacheKey;
+	bool m_isReplMode = false;
+	std::vector<std::string> m_replInputGlobalNames;
+	size_t m_replInputSymbolTableSize = 0;
 };
 
 #endif
@@ -40,25 +40,25 @@ llvm::Type * LlvmHelper::CreateType(llvm::LLVMContext & context, std::string con
 	return llvm::ArrayType::get(elementType, stoi(arraySizeString));
 }
 
-llvm::Constant * LlvmHelper::CreateConstant(llvm::LLVMContext & context, std::string const & type, std::string const & value)
+llvm::Constant * LlvmHelper::CreateConstant(llvm::LLVMContext & context, std::string const & type, LiteralValue const & value)
 {
-	if (type == TokenConstant::CoreType::Number::INTEGER)
+	if (type == TokenConstant::CoreType::Number::INTEGER && value.IsNumber())
 	{
-		return LlvmHelper::CreateInteger32Constant(context, std::stoi(value));
+		return LlvmHelper::CreateInteger32Constant(context, static_cast<int>(value.GetInteger()));
 	}
-	else if (type == TokenConstant::CoreType::Number::FLOAT)
+	else if (type == TokenConstant::CoreType::Number::FLOAT && value.IsNumber())
 	{
-		return LlvmHelper::CreateFloatConstant(context, std::stof(value));
+		return LlvmHelper::CreateFloatConstant(context, value.GetFloat());
 	}
-	else if (type == TokenConstant::CoreType::BOOLEAN)
+	else if (type == TokenConstant::CoreType::BOOLEAN && value.IsBoolean())
 	{
-		return LlvmHelper::CreateBooleanConstant(context, value);
+		return LlvmHelper::CreateBooleanConstant(context, value.GetBoolean());
 	}
-	else if (type == TokenConstant::CoreType::CHARACTER)
+	else if (type == TokenConstant::CoreType::CHARACTER && value.IsCharacter())
 	{
-		return LlvmHelper::CreateCharacterConstant(context, value[1]);
+		return LlvmHelper::CreateCharacterConstant(context, value.GetCharacter());
 	}
-	throw std::runtime_error("LlvmHelper::CreateConstant: Unsupported type \"" + type + "\"");
+	throw std::runtime_error("LlvmHelper::CreateConstant: Unsupported type \"" + type + "\" for value \"" + value.ToString() + "\"");
 }
 
 llvm::Constant * LlvmHelper::CreateBooleanConstant(llvm::LLVMContext & context, bool value)
@@ -66,19 +66,6 @@ llvm::Constant * LlvmHelper::CreateBooleanConstant(llvm::LLVMContext & context,
 	return llvm::ConstantInt::get(llvm::Type::getInt1Ty(context), value, false);
 }
 
-llvm::Constant * LlvmHelper::CreateBooleanConstant(llvm::LLVMContext & context, std::string const & value)
-{
-	if (value == "True")
-	{
-		return LlvmHelper::CreateBooleanConstant(context, true);
-	}
-	else if (value == "False")
-	{
-		return LlvmHelper::CreateBooleanConstant(context, false);
-	}
-	throw std::runtime_error("LlvmHelper::CreateConstant: \"" + value + "\"" + " is not boolean literal, possible values: \"True\", \"False\"");
-}
-
 llvm::Constant * LlvmHelper::CreateArrayConstant(llvm::LLVMContext & context, llvm::Type * arrayLiteralElementType, std::vector<llvm::Value *> const & arrayLiteralValues)
 {
 	std::vector<llvm::Constant*> values;
@@ -110,6 +97,26 @@ llvm::Constant * LlvmHelper::CreateFloatConstant(llvm::LLVMContext & context, do
 	return llvm::ConstantFP::get(llvm::Type::getDoubleTy(context), value);
 }
 
+llvm::Constant * LlvmHelper::GetSplatValue(llvm::Constant * constant)
+{
+	llvm::ArrayType * arrayType = llvm::dyn_cast<llvm::ArrayType>(constant->getType());
+	if (arrayType == nullptr)
+	{
+		return constant;
+	}
+	llvm::Constant * splatValue = nullptr;
+	for (uint64_t i = 0; i < arrayType->getNumElements(); ++i)
+	{
+		llvm::Constant * elementSplatValue = GetSplatValue(constant->getAggregateElement(i));
+		if (elementSplatValue == nullptr || (splatValue != nullptr && elementSplatValue != splatValue))
+		{
+			return nullptr;
+		}
+		splatValue = elementSplatValue;
+	}
+	return splatValue;
+}
+
 llvm::Value * LlvmHelper::CreateAdd(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name)
 {
 	if (type == TokenConstant::CoreType::Number::INTEGER)
@@ -191,8 +198,72 @@ llvm::Value * LlvmHelper::CreateSRem(llvm::IRBuilder<> * builder, std::string co
 	throw std::runtime_error("LlvmHelper::CreateSRem: Unsupported type \"" + type + "\"");
 }
 
+llvm::Value * LlvmHelper::CreateCompare(llvm::IRBuilder<> * builder, llvm::CmpInst::Predicate floatPredicate, llvm::Value * lhs, llvm::Value * rhs, std::string const & name)
+{
+	if (lhs->getType()->isFloatingPointTy() || rhs->getType()->isFloatingPointTy())
+	{
+		return builder->CreateFCmp(floatPredicate, ConvertToFloat(builder, lhs), ConvertToFloat(builder, rhs), name);
+	}
+	if (!lhs->getType()->isIntegerTy() || !rhs->getType()->isIntegerTy())
+	{
+		throw std::runtime_error("LlvmHelper::CreateCompare: Unsupported operand types");
+	}
+	// Only two booleans compare unsigned; a boolean against a number is widened to 0 or 1 and compared signed
+	bool const isBoolean = lhs->getType()->isIntegerTy(1) && rhs->getType()->isIntegerTy(1);
+	if (lhs->getType() != rhs->getType())
+	{
+		llvm::Type * type = lhs->getType()->getIntegerBitWidth() > rhs->getType()->getIntegerBitWidth() ? lhs->getType() : rhs->getType();
+		lhs = lhs->getType()->isIntegerTy(1) ? builder->CreateZExt(lhs, type) : builder->CreateSExt(lhs, type);
+		rhs = rhs->getType()->isIntegerTy(1) ? builder->CreateZExt(rhs, type) : builder->CreateSExt(rhs, type);
+	}
+	return builder->CreateICmp(ToIntegerPredicate(floatPredicate, isBoolean), lhs, rhs, name);
+}
+
+llvm::Value * LlvmHelper::CreateCondition(llvm::IRBuilder<> * builder, llvm::Value * value, std::string const & name)
+{
+	llvm::Type * type = value->getType();
+	if (type->isIntegerTy(1))
+	{
+		return value;
+	}
+	if (type->isIntegerTy())
+	{
+		return builder->CreateICmpNE(value, llvm::ConstantInt::get(type, 0), name);
+	}
+	if (type->isFloatingPointTy())
+	{
+		return builder->CreateFCmpONE(value, llvm::ConstantFP::get(type, 0.0), name);
+	}
+	throw std::runtime_error("LlvmHelper::CreateCondition: Unsupported condition type");
+}
+
+llvm::CmpInst::Predicate LlvmHelper::ToIntegerPredicate(llvm::CmpInst::Predicate floatPredicate, bool isUnsigned)
+{
+	switch (floatPredicate)
+	{
+		case llvm::CmpInst::FCMP_OEQ:
+			return llvm::CmpInst::ICMP_EQ;
+		case llvm::CmpInst::FCMP_ONE:
+			return llvm::CmpInst::ICMP_NE;
+		case llvm::CmpInst::FCMP_OGT:
+			return isUnsigned ? llvm::CmpInst::ICMP_UGT : llvm::CmpInst::ICMP_SGT;
+		case llvm::CmpInst::FCMP_OGE:
+			return isUnsigned ? llvm::CmpInst::ICMP_UGE : llvm::CmpInst::ICMP_SGE;
+		case llvm::CmpInst::FCMP_OLT:
+			return isUnsigned ? llvm::CmpInst::ICMP_ULT : llvm::CmpInst::ICMP_SLT;
+		case llvm::CmpInst::FCMP_OLE:
+			return isUnsigned ? llvm::CmpInst::ICMP_ULE : llvm::CmpInst::ICMP_SLE;
+		default:
+			throw std::runtime_error("LlvmHelper::ToIntegerPredicate: Unsupported predicate");
+	}
+}
+
 llvm::Value * LlvmHelper::ConvertToFloat(llvm::IRBuilder<> * builder, llvm::Value * value)
 {
+	if (value->getType()->isIntegerTy(1))
+	{
+		return builder->CreateUIToFP(value, llvm::Type::getDoubleTy(builder->getContext()), "conversion_to_float");
+	}
 	return builder->CreateSIToFP(value, llvm::Type::getDoubleTy(builder->getContext()), "conversion_to_float");
 }
 
@@ -200,3 +271,25 @@ llvm::Value * LlvmHelper::ConvertToInteger(llvm::IRBuilder<> * builder, llvm::Va
 {
 	return builder->CreateFPToSI(value, llvm::Type::getInt32Ty(builder->getContext()), "conversion_to_integer");
 }
+
+llvm::Value * LlvmHelper::ConvertToType(llvm::IRBuilder<> * builder, llvm::Value * value, llvm::Type * type)
+{
+	llvm::Type * valueType = value->getType();
+	if (valueType == type)
+	{
+		return value;
+	}
+	if (valueType->isIntegerTy() && type->isFloatingPointTy())
+	{
+		return ConvertToFloat(builder, value);
+	}
+	if (valueType->isFloatingPointTy() && type->isIntegerTy())
+	{
+		return builder->CreateFPToSI(value, type, "conversion_to_integer");
+	}
+	if (valueType->isIntegerTy() && type->isIntegerTy())
+	{
+		return valueType->isIntegerTy(1) ? builder->CreateZExtOrTrunc(value, type) : builder->CreateSExtOrTrunc(value, type);
+	}
+	return value;
+}
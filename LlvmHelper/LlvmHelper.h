@@ -1,6 +1,7 @@
 #ifndef LLPARSERLIBRARYEXAMPLE_LLVMHELPER_H
 #define LLPARSERLIBRARYEXAMPLE_LLVMHELPER_H
 
+#include "../AstNode/LiteralValue/LiteralValue.h"
 #include <llvm/IR/Constant.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/IRBuilder.h>
@@ -9,24 +10,29 @@ class LlvmHelper
 {
 public:
 	static llvm::Type * CreateType(llvm::LLVMContext & context, std::string const & type, std::string const & arraySizeString = "");
-	static llvm::Constant * CreateConstant(llvm::LLVMContext & context, std::string const & type, std::string const & value);
+	static llvm::Constant * CreateConstant(llvm::LLVMContext & context, std::string const & type, LiteralValue const & value);
 	static llvm::Constant * CreateBooleanConstant(llvm::LLVMContext & context, bool value);
-	static llvm::Constant * CreateBooleanConstant(llvm::LLVMContext & context, std::string const & value);
 	static llvm::Constant * CreateArrayConstant(llvm::LLVMContext & context, llvm::Type * arrayLiteralElementType, std::vector<llvm::Value *> const & arrayLiteralValues);
 	static llvm::Constant * CreateCharacterConstant(llvm::LLVMContext & context, char value);
 	static llvm::Constant * CreateInteger32Constant(llvm::LLVMContext & context, int value);
 	static llvm::Constant * CreateInteger64Constant(llvm::LLVMContext & context, int value);
 	static llvm::Constant * CreateFloatConstant(llvm::LLVMContext & context, double value);
+	static llvm::Constant * GetSplatValue(llvm::Constant * constant);
 	static llvm::Value * CreateAdd(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
 	static llvm::Value * CreateSub(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
 	static llvm::Value * CreateMul(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
 	static llvm::Value * CreateSDiv(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
 	static llvm::Value * CreateExactSDiv(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
 	static llvm::Value * CreateSRem(llvm::IRBuilder<> * builder, std::string const & type, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
+	static llvm::Value * CreateCompare(llvm::IRBuilder<> * builder, llvm::CmpInst::Predicate floatPredicate, llvm::Value * lhs, llvm::Value * rhs, std::string const & name);
+	static llvm::Value * CreateCondition(llvm::IRBuilder<> * builder, llvm::Value * value, std::string const & name);
 	static llvm::Value * ConvertToFloat(llvm::IRBuilder<> * builder, llvm::Value * value);
 	static llvm::Value * ConvertToInteger(llvm::IRBuilder<> * builder, llvm::Value * value);
+	static llvm::Value * ConvertToType(llvm::IRBuilder<> * builder, llvm::Value * value, llvm::Type * type);
 private:
 	LlvmHelper() = default;
+
+	static llvm::CmpInst::Predicate ToIntegerPredicate(llvm::CmpInst::Predicate floatPredicate, bool isUnsigned);
 };
 
 #endif
@@ -0,0 +1,11 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_PARSESTATUS_H
+#define LLPARSERLIBRARYEXAMPLE_PARSESTATUS_H
+
+enum class ParseStatus
+{
+	NEED_TOKEN,
+	ACCEPTED,
+	REJECTED
+};
+
+#endif
@@ -0,0 +1,14 @@
+#include "ParserState.h"
+
+void ParserState::Reset()
+{
+	status = ParseStatus::NEED_TOKEN;
+	currentRowId = 1;
+	stack = std::stack<unsigned int>();
+	inputWordIndex = 0;
+	isShiftPending = false;
+	tokenInformations.clear();
+	failIndex = 0;
+	isInputExhausted = false;
+	expectedTokens.clear();
+}
@@ -0,0 +1,28 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_PARSERSTATE_H
+#define LLPARSERLIBRARYEXAMPLE_PARSERSTATE_H
+
+#include "ParseStatus/ParseStatus.h"
+#include "../LexerLibrary/TokenLibrary/Token.h"
+#include "../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include <stack>
+#include <unordered_set>
+#include <vector>
+
+class ParserState
+{
+public:
+	void Reset();
+
+	ParseStatus status = ParseStatus::NEED_TOKEN;
+	unsigned int currentRowId = 1;
+	std::stack<unsigned int> stack;
+	size_t inputWordIndex = 0;
+	bool isShiftPending = false;
+	std::vector<TokenInformation> tokenInformations;
+	size_t failIndex = 0;
+	// Set when the input ended while the parser still expected tokens, rather than on a wrong token.
+	bool isInputExhausted = false;
+	std::unordered_set<Token> expectedTokens;
+};
+
+#endif
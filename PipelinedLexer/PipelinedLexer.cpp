@@ -0,0 +1,102 @@
+#include "PipelinedLexer.h"
+#include "../LexerLibrary/Lexer.h"
+
+PipelinedLexer::PipelinedLexer(std::string const & inputFileName, size_t batchSize, size_t queueCapacity)
+	: m_queue(queueCapacity)
+	, m_batchSize(batchSize)
+{
+	m_thread = std::thread(&PipelinedLexer::Produce, this, inputFileName);
+}
+
+PipelinedLexer::~PipelinedLexer()
+{
+	m_isStopped.store(true, std::memory_order_relaxed);
+	m_queue.WakeAll();
+	if (m_thread.joinable())
+	{
+		m_thread.join();
+	}
+}
+
+bool PipelinedLexer::GetNextTokenInformation(TokenInformation & tokenInformation)
+{
+	if (m_batchIndex == m_batch.size() && !PopBatch())
+	{
+		return false;
+	}
+	tokenInformation = std::move(m_batch[m_batchIndex++]);
+
+	return true;
+}
+
+void PipelinedLexer::Produce(std::string const & inputFileName)
+{
+	try
+	{
+		Lexer lexer(inputFileName);
+		std::vector<TokenInformation> batch;
+		batch.reserve(m_batchSize);
+		TokenInformation tokenInformation;
+		while (lexer.GetNextTokenInformation(tokenInformation))
+		{
+			batch.emplace_back(std::move(tokenInformation));
+			if (batch.size() == m_batchSize && !PushBatch(batch))
+			{
+				break;
+			}
+		}
+		if (!batch.empty())
+		{
+			PushBatch(batch);
+		}
+	}
+	catch (...)
+	{
+		m_producerException = std::current_exception();
+	}
+	m_queue.Close();
+}
+
+bool PipelinedLexer::PushBatch(std::vector<TokenInformation> & batch)
+{
+	while (!m_queue.TryPush(batch))
+	{
+		if (m_isStopped.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+		m_queue.WaitForSpace(m_isStopped);
+	}
+	batch.clear();
+	batch.reserve(m_batchSize);
+
+	return true;
+}
+
+bool PipelinedLexer::PopBatch()
+{
+	m_batch.clear();
+	m_batchIndex = 0;
+	while (m_batch.empty())
+	{
+		if (m_queue.TryPop(m_batch))
+		{
+			continue;
+		}
+		if (m_queue.IsClosed())
+		{
+			if (m_queue.TryPop(m_batch))
+			{
+				continue;
+			}
+			if (m_producerException)
+			{
+				std::rethrow_exception(m_producerException);
+			}
+			return false;
+		}
+		m_queue.WaitForBatch();
+	}
+
+	return true;
+}
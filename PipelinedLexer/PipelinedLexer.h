@@ -0,0 +1,42 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_PIPELINEDLEXER_H
+#define LLPARSERLIBRARYEXAMPLE_PIPELINEDLEXER_H
+
+#include "../TokenQueue/TokenQueue.h"
+#include <atomic>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs the lexer on its own thread and hands tokens to the parser thread in batches.
+// The queue capacity bounds how far the lexer may run ahead of the parser.
+class PipelinedLexer
+{
+public:
+	static size_t const DEFAULT_BATCH_SIZE = 256;
+	static size_t const DEFAULT_QUEUE_CAPACITY = 64;
+
+	explicit PipelinedLexer(
+		std::string const & inputFileName,
+		size_t batchSize = DEFAULT_BATCH_SIZE,
+		size_t queueCapacity = DEFAULT_QUEUE_CAPACITY
+	);
+	~PipelinedLexer();
+
+	bool GetNextTokenInformation(TokenInformation & tokenInformation);
+
+private:
+	void Produce(std::string const & inputFileName);
+	bool PushBatch(std::vector<TokenInformation> & batch);
+	bool PopBatch();
+
+	TokenQueue m_queue;
+	size_t m_batchSize;
+	std::vector<TokenInformation> m_batch;
+	size_t m_batchIndex = 0;
+	std::atomic<bool> m_isStopped { false };
+	std::exception_ptr m_producerException;
+	std::thread m_thread;
+};
+
+#endif
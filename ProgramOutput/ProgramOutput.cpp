@@ -0,0 +1,41 @@
+#include "ProgramOutput.h"
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+thread_local std::ostream * ProgramOutput::s_output = &std::cout;
+
+ProgramOutput::ProgramOutput(std::ostream * output)
+	: m_previousOutput(s_output)
+{
+	s_output = output;
+}
+
+ProgramOutput::~ProgramOutput()
+{
+	if (s_output != nullptr)
+	{
+		s_output->flush();
+	}
+	s_output = m_previousOutput;
+}
+
+int ProgramOutput::Printf(char const * format, ...)
+{
+	va_list arguments;
+	va_start(arguments, format);
+	va_list sizeArguments;
+	va_copy(sizeArguments, arguments);
+	int const length = std::vsnprintf(nullptr, 0, format, sizeArguments);
+	va_end(sizeArguments);
+	if (length > 0 && s_output != nullptr)
+	{
+		std::vector<char> buffer(static_cast<size_t>(length) + 1);
+		std::vsnprintf(buffer.data(), buffer.size(), format, arguments);
+		s_output->write(buffer.data(), length);
+	}
+	va_end(arguments);
+
+	return length;
+}
@@ -0,0 +1,25 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_PROGRAMOUTPUT_H
+#define LLPARSERLIBRARYEXAMPLE_PROGRAMOUTPUT_H
+
+#include <ostream>
+
+// Redirects the output of JIT-executed programs: their printf calls are bound to Printf, which writes to the output
+// selected by the innermost ProgramOutput alive on the calling thread, so programs run in parallel keep it apart.
+// Without one the output goes to std::cout; a null output discards it.
+class ProgramOutput
+{
+public:
+	explicit ProgramOutput(std::ostream * output);
+	~ProgramOutput();
+	ProgramOutput(ProgramOutput const &) = delete;
+	ProgramOutput & operator=(ProgramOutput const &) = delete;
+
+	static int Printf(char const * format, ...);
+
+private:
+	static thread_local std::ostream * s_output;
+
+	std::ostream * m_previousOutput;
+};
+
+#endif
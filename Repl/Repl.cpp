@@ -0,0 +1,157 @@
+#include "Repl.h"
+#include "../LexerLibrary/Lexer.h"
+#include "../ProgramOutput/ProgramOutput.h"
+#include <fstream>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+
+Repl::Repl(std::string const & ruleFileName)
+	: m_parser(ruleFileName)
+{
+	SetCompileOptions(m_compileOptions);
+	llvm::SmallString<128> inputFileName;
+	if (std::error_code errorCode = llvm::sys::fs::createTemporaryFile("llparser_repl", "txt", inputFileName))
+	{
+		ReportError("Could not create the REPL input file: " + errorCode.message() + "\n");
+
+		return;
+	}
+	m_inputFileName = inputFileName.str().str();
+}
+
+Repl::~Repl()
+{
+	if (!m_inputFileName.empty())
+	{
+		llvm::sys::fs::remove(m_inputFileName);
+	}
+}
+
+void Repl::SetCompileOptions(CompileOptions const & compileOptions)
+{
+	m_compileOptions = compileOptions;
+	m_compileOptions.execute = false;
+	m_compileOptions.emitObject = false;
+	m_compileOptions.recodeOutput = nullptr;
+	m_compileOptions.irOutput = nullptr;
+	m_compileOptions.runSemanticAnalysis = true;
+	// The globals of earlier inputs live in the JIT, so dropping it also drops the variables that refer to them
+	m_jit = nullptr;
+	m_parser.Reset();
+	m_parser.SetCompileOptions(m_compileOptions);
+	m_inputCount = 0;
+}
+
+bool Repl::Evaluate(std::string const & input, bool & isIncomplete, int & exitCode)
+{
+	isIncomplete = false;
+	std::vector<TokenInformation> tokenInformations;
+	if (!ReadTokenInformations(input, tokenInformations) || (m_jit == nullptr && !CreateJit()))
+	{
+		return false;
+	}
+	std::string const functionName = "repl_" + std::to_string(m_inputCount);
+	std::unique_ptr<llvm::Module> module;
+	if (!m_parser.CompileReplInput(tokenInformations, functionName, module))
+	{
+		ParserState const & parserState = m_parser.GetParserState();
+		isIncomplete = parserState.isInputExhausted;
+
+		return false;
+	}
+	++m_inputCount;
+	module->setDataLayout(m_jit->getDataLayout());
+	// The declarations of a rejected input never ran, so later inputs must not see them
+	if (llvm::Error error = m_jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), m_parser.GetThreadSafeContext())))
+	{
+		ReportError("JIT: " + llvm::toString(std::move(error)) + "\n");
+		m_parser.RollBackReplInput();
+
+		return false;
+	}
+	llvm::Expected<llvm::JITEvaluatedSymbol> functionSymbol = m_jit->lookup(functionName);
+	if (!functionSymbol)
+	{
+		ReportError("JIT: " + llvm::toString(functionSymbol.takeError()) + "\n");
+		m_parser.RollBackReplInput();
+
+		return false;
+	}
+	auto function = reinterpret_cast<int (*)()>(static_cast<uintptr_t>(functionSymbol->getAddress()));
+	ProgramOutput programOutput(m_compileOptions.executionOutput);
+	exitCode = function();
+
+	return true;
+}
+
+void Repl::Run(std::istream & input, std::ostream & output)
+{
+	std::string pendingInput;
+	std::string line;
+	output << "> " << std::flush;
+	while (std::getline(input, line))
+	{
+		pendingInput += line + "\n";
+		bool isIncomplete;
+		int exitCode;
+		Evaluate(pendingInput, isIncomplete, exitCode);
+		if (isIncomplete)
+		{
+			output << ". " << std::flush;
+
+			continue;
+		}
+		pendingInput.clear();
+		output << "> " << std::flush;
+	}
+	output << std::endl;
+}
+
+bool Repl::CreateJit()
+{
+	if (m_compilerSession == nullptr
+		|| !m_compilerSession->IsCreatedFor(m_compileOptions.targetCpu, m_compileOptions.targetFeatures))
+	{
+		m_compilerSession = std::make_unique<CompilerSession>(m_compileOptions.targetCpu, m_compileOptions.targetFeatures);
+	}
+	std::string errorMessage = m_compilerSession->GetErrorMessage();
+	if (!m_compilerSession->IsReady() || !m_compilerSession->CreateJit(nullptr, m_jit, errorMessage))
+	{
+		ReportError(errorMessage);
+
+		return false;
+	}
+	return true;
+}
+
+void Repl::ReportError(std::string const & message) const
+{
+	if (m_compileOptions.diagnosticOutput != nullptr)
+	{
+		*m_compileOptions.diagnosticOutput << message;
+	}
+}
+
+bool Repl::ReadTokenInformations(std::string const & input, std::vector<TokenInformation> & tokenInformations) const
+{
+	if (m_inputFileName.empty())
+	{
+		return false;
+	}
+	{
+		std::ofstream inputFile(m_inputFileName, std::ios::trunc);
+		inputFile << input;
+		if (!inputFile)
+		{
+			return false;
+		}
+	}
+	Lexer lexer(m_inputFileName);
+	TokenInformation tokenInformation;
+	while (lexer.GetNextTokenInformation(tokenInformation))
+	{
+		tokenInformations.emplace_back(std::move(tokenInformation));
+	}
+	return true;
+}
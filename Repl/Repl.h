@@ -0,0 +1,37 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_REPL_H
+#define LLPARSERLIBRARYEXAMPLE_REPL_H
+
+#include "../LLParser.h"
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+// Interactive driver: every input is parsed against the scopes and symbol table left by the earlier inputs,
+// lowered into its own function and module, and run at once on a JIT that lives as long as the REPL.
+// Top-level variables become globals, so later inputs reach them through external declarations.
+// Changing the compile options starts a new session without the variables of earlier inputs.
+class Repl
+{
+public:
+	explicit Repl(std::string const & ruleFileName);
+	~Repl();
+
+	void SetCompileOptions(CompileOptions const & compileOptions);
+	bool Evaluate(std::string const & input, bool & isIncomplete, int & exitCode);
+	void Run(std::istream & input, std::ostream & output);
+
+private:
+	bool CreateJit();
+	void ReportError(std::string const & message) const;
+	bool ReadTokenInformations(std::string const & input, std::vector<TokenInformation> & tokenInformations) const;
+
+	LLParser m_parser;
+	CompileOptions m_compileOptions;
+	std::unique_ptr<CompilerSession> m_compilerSession;
+	std::unique_ptr<llvm::orc::LLLazyJIT> m_jit;
+	unsigned int m_inputCount = 0;
+	std::string m_inputFileName;
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include "SsaBuilder.h"
+#include <vector>
+#include <llvm/IR/CFG.h>
+#include <llvm/IR/Constants.h>
+
+void SsaBuilder::Reset()
+{
+	m_variableTypes.clear();
+	m_currentDefinitions.clear();
+	m_incompletePhis.clear();
+	m_sealedBlocks.clear();
+}
+
+void SsaBuilder::DeclareVariable(unsigned int variable, llvm::Type * type)
+{
+	m_variableTypes[variable] = type;
+}
+
+void SsaBuilder::WriteVariable(unsigned int variable, llvm::BasicBlock * block, llvm::Value * value)
+{
+	m_currentDefinitions[block][variable] = value;
+}
+
+llvm::Value * SsaBuilder::ReadVariable(unsigned int variable, llvm::BasicBlock * block)
+{
+	auto const blockDefinitions = m_currentDefinitions.find(block);
+	if (blockDefinitions != m_currentDefinitions.end())
+	{
+		auto const definition = blockDefinitions->second.find(variable);
+		if (definition != blockDefinitions->second.end() && definition->second != nullptr)
+		{
+			return definition->second;
+		}
+	}
+	return ReadVariableRecursive(variable, block);
+}
+
+void SsaBuilder::SealBlock(llvm::BasicBlock * block)
+{
+	if (!m_sealedBlocks.insert(block).second)
+	{
+		return;
+	}
+	auto const incompletePhis = m_incompletePhis.find(block);
+	if (incompletePhis == m_incompletePhis.end())
+	{
+		return;
+	}
+	std::unordered_map<unsigned int, llvm::PHINode *> phis = std::move(incompletePhis->second);
+	m_incompletePhis.erase(incompletePhis);
+	for (std::pair<unsigned int const, llvm::PHINode *> & phi : phis)
+	{
+		AddPhiOperands(phi.first, phi.second);
+	}
+}
+
+llvm::Value * SsaBuilder::ReadVariableRecursive(unsigned int variable, llvm::BasicBlock * block)
+{
+	llvm::Value * value;
+	if (m_sealedBlocks.find(block) == m_sealedBlocks.end())
+	{
+		llvm::PHINode * phi = CreatePhi(variable, block);
+		m_incompletePhis[block][variable] = phi;
+		value = phi;
+	}
+	else if (llvm::pred_empty(block))
+	{
+		value = llvm::UndefValue::get(m_variableTypes.at(variable));
+	}
+	else if (llvm::BasicBlock * predecessor = block->getSinglePredecessor())
+	{
+		value = ReadVariable(variable, predecessor);
+	}
+	else
+	{
+		llvm::PHINode * phi = CreatePhi(variable, block);
+		WriteVariable(variable, block, phi);
+		value = AddPhiOperands(variable, phi);
+	}
+	WriteVariable(variable, block, value);
+
+	return value;
+}
+
+llvm::Value * SsaBuilder::AddPhiOperands(unsigned int variable, llvm::PHINode * phi)
+{
+	llvm::BasicBlock * block = phi->getParent();
+	for (llvm::BasicBlock * predecessor : llvm::predecessors(block))
+	{
+		phi->addIncoming(ReadVariable(variable, predecessor), predecessor);
+	}
+	return TryRemoveTrivialPhi(phi);
+}
+
+llvm::Value * SsaBuilder::TryRemoveTrivialPhi(llvm::PHINode * phi)
+{
+	if (m_sealedBlocks.find(phi->getParent()) == m_sealedBlocks.end())
+	{
+		return phi;
+	}
+	llvm::Value * same = nullptr;
+	for (llvm::Value * operand : phi->incoming_values())
+	{
+		if (operand == same || operand == phi)
+		{
+			continue;
+		}
+		if (same != nullptr)
+		{
+			return phi;
+		}
+		same = operand;
+	}
+	if (same == nullptr)
+	{
+		same = llvm::UndefValue::get(phi->getType());
+	}
+	llvm::WeakTrackingVH result = same;
+	std::vector<llvm::WeakVH> phiUsers;
+	for (llvm::User * user : phi->users())
+	{
+		if (user != phi && llvm::isa<llvm::PHINode>(user))
+		{
+			phiUsers.emplace_back(user);
+		}
+	}
+	phi->replaceAllUsesWith(same);
+	phi->eraseFromParent();
+	for (llvm::WeakVH & phiUser : phiUsers)
+	{
+		if (auto * userPhi = llvm::dyn_cast_or_null<llvm::PHINode>(phiUser))
+		{
+			TryRemoveTrivialPhi(userPhi);
+		}
+	}
+	return result;
+}
+
+llvm::PHINode * SsaBuilder::CreatePhi(unsigned int variable, llvm::BasicBlock * block)
+{
+	llvm::Type * type = m_variableTypes.at(variable);
+	if (llvm::Instruction * firstNonPhi = block->getFirstNonPHI())
+	{
+		return llvm::PHINode::Create(type, 0, "", firstNonPhi);
+	}
+	return llvm::PHINode::Create(type, 0, "", block);
+}
@@ -0,0 +1,34 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_SSABUILDER_H
+#define LLPARSERLIBRARYEXAMPLE_SSABUILDER_H
+
+#include <unordered_map>
+#include <unordered_set>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/ValueHandle.h>
+
+// Builds SSA form for scalar variables while the IR is emitted (Braun et al., "Simple and Efficient Construction
+// of Static Single Assignment Form"). A block is sealed once all its predecessors are known; reads in a block
+// that is not sealed yet create incomplete phis that get their operands on sealing.
+class SsaBuilder
+{
+public:
+	void Reset();
+	void DeclareVariable(unsigned int variable, llvm::Type * type);
+	void WriteVariable(unsigned int variable, llvm::BasicBlock * block, llvm::Value * value);
+	llvm::Value * ReadVariable(unsigned int variable, llvm::BasicBlock * block);
+	void SealBlock(llvm::BasicBlock * block);
+
+private:
+	llvm::Value * ReadVariableRecursive(unsigned int variable, llvm::BasicBlock * block);
+	llvm::Value * AddPhiOperands(unsigned int variable, llvm::PHINode * phi);
+	llvm::Value * TryRemoveTrivialPhi(llvm::PHINode * phi);
+	llvm::PHINode * CreatePhi(unsigned int variable, llvm::BasicBlock * block);
+
+	std::unordered_map<unsigned int, llvm::Type *> m_variableTypes;
+	std::unordered_map<llvm::BasicBlock *, std::unordered_map<unsigned int, llvm::WeakTrackingVH>> m_currentDefinitions;
+	std::unordered_map<llvm::BasicBlock *, std::unordered_map<unsigned int, llvm::PHINode *>> m_incompletePhis;
+	std::unordered_set<llvm::BasicBlock *> m_sealedBlocks;
+};
+
+#endif
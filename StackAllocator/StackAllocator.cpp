@@ -0,0 +1,30 @@
+#include "StackAllocator.h"
+
+void StackAllocator::Reset(llvm::BasicBlock * entryBlock)
+{
+	m_entryBlock = entryBlock;
+	m_lastAlloca = nullptr;
+	m_freeSlots.clear();
+}
+
+llvm::AllocaInst * StackAllocator::Allocate(llvm::Type * type, std::string const & name, bool & isReused)
+{
+	std::vector<llvm::AllocaInst *> & freeSlots = m_freeSlots[type];
+	isReused = !freeSlots.empty();
+	if (isReused)
+	{
+		llvm::AllocaInst * slot = freeSlots.back();
+		freeSlots.pop_back();
+
+		return slot;
+	}
+	llvm::IRBuilder<> entryBuilder(m_entryBlock, m_lastAlloca == nullptr ? m_entryBlock->begin() : std::next(m_lastAlloca->getIterator()));
+	m_lastAlloca = entryBuilder.CreateAlloca(type, nullptr, name);
+
+	return m_lastAlloca;
+}
+
+void StackAllocator::Release(llvm::AllocaInst * slot)
+{
+	m_freeSlots[slot->getAllocatedType()].emplace_back(slot);
+}
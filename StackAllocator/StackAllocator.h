@@ -0,0 +1,26 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_STACKALLOCATOR_H
+#define LLPARSERLIBRARYEXAMPLE_STACKALLOCATOR_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+
+// Places every alloca of a function in its entry block, so declarations inside loops do not grow the stack.
+// Slots released at the end of a scope are handed out again to later variables of the same type;
+// a reused slot has already passed its lifetime end, so the caller has to start its lifetime again.
+class StackAllocator
+{
+public:
+	void Reset(llvm::BasicBlock * entryBlock);
+	llvm::AllocaInst * Allocate(llvm::Type * type, std::string const & name, bool & isReused);
+	void Release(llvm::AllocaInst * slot);
+
+private:
+	llvm::BasicBlock * m_entryBlock = nullptr;
+	llvm::AllocaInst * m_lastAlloca = nullptr;
+	std::unordered_map<llvm::Type *, std::vector<llvm::AllocaInst *>> m_freeSlots;
+};
+
+#endif
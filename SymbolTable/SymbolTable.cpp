@@ -6,18 +6,25 @@
 unsigned int SymbolTable::CreateRow(
 	std::string const & type,
 	std::string const & name,
-	llvm::AllocaInst * llvmAllocaInst,
+	llvm::Value * llvmPointer,
+	llvm::Type * llvmType,
 	std::vector<unsigned int> const & dimensions
 )
 {
 	SymbolTableRow symbolTableRow;
 	symbolTableRow.type = type;
 	symbolTableRow.name = name;
-	symbolTableRow.llvmAllocaInst = llvmAllocaInst;
+	symbolTableRow.llvmPointer = llvmPointer;
 	if (!dimensions.empty())
 	{
 		ArrayInformation * arrayInformation = new ArrayInformation();
 		arrayInformation->dimensions = dimensions;
+		arrayInformation->llvmType = llvmType;
+		arrayInformation->elementCount = 1;
+		for (unsigned int dimension : dimensions)
+		{
+			arrayInformation->elementCount *= dimension;
+		}
 		symbolTableRow.arrayInformation = arrayInformation;
 	}
 	m_table.emplace_back(symbolTableRow);
@@ -37,6 +44,37 @@ bool SymbolTable::RemoveRow(unsigned int rowIndex)
 	return result;
 }
 
+void SymbolTable::SetGlobal(unsigned int rowIndex, llvm::Type * llvmGlobalType, std::string const & globalName)
+{
+	if (rowIndex < m_table.size())
+	{
+		m_table[rowIndex].llvmGlobalType = llvmGlobalType;
+		m_table[rowIndex].globalName = globalName;
+	}
+}
+
+void SymbolTable::Truncate(size_t size)
+{
+	for (size_t i = size; i < m_table.size(); ++i)
+	{
+		delete m_table[i].arrayInformation;
+	}
+	if (size < m_table.size())
+	{
+		m_table.resize(size);
+	}
+}
+
+void SymbolTable::Clear()
+{
+	Truncate(0);
+}
+
+size_t SymbolTable::GetSize() const
+{
+	return m_table.size();
+}
+
 bool SymbolTable::GetSymbolTableRowByRowIndex(unsigned int rowIndex, SymbolTableRow & result) const
 {
 	if (rowIndex < m_table.size())
@@ -12,10 +12,15 @@ public:
 	unsigned int CreateRow(
 		std::string const & type,
 		std::string const & name,
-		llvm::AllocaInst * llvmAllocaInst,
+		llvm::Value * llvmPointer,
+		llvm::Type * llvmType,
 		std::vector<unsigned int> const & dimensions
 	);
 	bool RemoveRow(unsigned int rowIndex);
+	void SetGlobal(unsigned int rowIndex, llvm::Type * llvmGlobalType, std::string const & globalName);
+	void Truncate(size_t size);
+	void Clear();
+	size_t GetSize() const;
 	bool GetSymbolTableRowByRowIndex(unsigned int rowIndex, SymbolTableRow & result) const;
 
 private:
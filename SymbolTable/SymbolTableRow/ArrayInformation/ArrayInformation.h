@@ -1,12 +1,16 @@
 #ifndef LLPARSERLIBRARYEXAMPLE_ARRAYINFORMATION_H
 #define LLPARSERLIBRARYEXAMPLE_ARRAYINFORMATION_H
 
+#include <cstdint>
 #include <vector>
+#include <llvm/IR/Type.h>
 
 class ArrayInformation
 {
 public:
 	std::vector<unsigned int> dimensions;
+	uint64_t elementCount = 0;
+	llvm::Type * llvmType = nullptr;
 };
 
 #endif
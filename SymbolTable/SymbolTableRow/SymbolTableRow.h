@@ -10,7 +10,9 @@ class SymbolTableRow
 public:
 	std::string type;
 	std::string name;
-	llvm::AllocaInst * llvmAllocaInst;
+	llvm::Value * llvmPointer = nullptr;
+	llvm::Type * llvmGlobalType = nullptr;
+	std::string globalName;
 	ArrayInformation * arrayInformation = nullptr;
 };
 
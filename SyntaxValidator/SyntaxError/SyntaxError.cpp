@@ -0,0 +1 @@
+#include "SyntaxError.h"
@@ -0,0 +1,15 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_SYNTAXERROR_H
+#define LLPARSERLIBRARYEXAMPLE_SYNTAXERROR_H
+
+#include "../../LexerLibrary/TokenLibrary/Token.h"
+#include <cstddef>
+#include <unordered_set>
+
+class SyntaxError
+{
+public:
+	size_t failIndex = 0;
+	std::unordered_set<Token> expectedTokens;
+};
+
+#endif
@@ -0,0 +1,245 @@
+#include "SyntaxValidator.h"
+#include "../LLTableBuilderLibrary/Table/TableRow/TableRow.h"
+#include "../LLTableBuilderLibrary/TokenLibrary/TokenExtensions/TokenExtensions.h"
+#include <algorithm>
+#include <stack>
+
+SyntaxValidator::SyntaxValidator(Table const & table)
+	: m_table(table)
+{
+	m_canSplit = TryToResolveToken("Semicolon", m_semicolon) && TryToResolveToken("Else keyword", m_elseKeyword);
+	for (std::string const & bracketName : { "curly", "round", "square" })
+	{
+		Token leftBracket;
+		Token rightBracket;
+		if (TryToResolveToken("Left " + bracketName + " bracket", leftBracket)
+			&& TryToResolveToken("Right " + bracketName + " bracket", rightBracket))
+		{
+			m_leftBrackets.emplace_back(leftBracket);
+			m_rightBrackets.emplace_back(rightBracket);
+		}
+		else
+		{
+			m_canSplit = false;
+		}
+	}
+}
+
+bool SyntaxValidator::Validate(
+	std::vector<TokenInformation> const & tokenInformations,
+	size_t from,
+	size_t to,
+	SyntaxError & syntaxError
+) const
+{
+	// A segment that stops before the end of input borrows the final token of the input as its terminator
+	bool const hasTerminator = to < tokenInformations.size();
+	size_t const end = hasTerminator ? to + 1 : to;
+	std::stack<unsigned int> stack;
+	unsigned int currentRowId = 1;
+	size_t inputWordIndex = from;
+	syntaxError.failIndex = from;
+	if (from >= end)
+	{
+		return false;
+	}
+	while (true)
+	{
+		Token currentToken = hasTerminator && inputWordIndex == to
+			? tokenInformations.back().GetToken()
+			: tokenInformations[inputWordIndex].GetToken();
+		TableRow * currentRow = m_table.GetRow(currentRowId);
+		if (currentRow == nullptr)
+		{
+			syntaxError.failIndex = inputWordIndex;
+
+			return false;
+		}
+		if (IsComment(currentToken))
+		{
+			if (++inputWordIndex == end)
+			{
+				syntaxError.failIndex = inputWordIndex - 1;
+
+				return false;
+			}
+			continue;
+		}
+		if (currentRow->referencingSet.find(currentToken) != currentRow->referencingSet.end() || !currentRow->actionName.empty())
+		{
+			if (currentRow->isEnd && stack.empty())
+			{
+				return true;
+			}
+			if (currentRow->doShift)
+			{
+				if (++inputWordIndex == end)
+				{
+					syntaxError.failIndex = inputWordIndex - 1;
+
+					return false;
+				}
+			}
+			else if (currentRow->pushToStack != 0)
+			{
+				stack.push(currentRow->pushToStack);
+			}
+			if (currentRow->nextId != 0)
+			{
+				currentRowId = currentRow->nextId;
+			}
+			else
+			{
+				if (stack.empty())
+				{
+					syntaxError.failIndex = inputWordIndex;
+
+					return false;
+				}
+				currentRowId = stack.top();
+				stack.pop();
+			}
+		}
+		else if (currentRow->isError)
+		{
+			syntaxError.failIndex = inputWordIndex;
+			unsigned int errorRowId = currentRowId;
+			while (currentRow != nullptr && (errorRowId == currentRowId || !currentRow->isError))
+			{
+				syntaxError.expectedTokens.insert(currentRow->referencingSet.begin(), currentRow->referencingSet.end());
+				--errorRowId;
+				currentRow = m_table.GetRow(errorRowId);
+			}
+			return false;
+		}
+		else
+		{
+			++currentRowId;
+		}
+	}
+}
+
+bool SyntaxValidator::ValidateInParallel(
+	std::vector<TokenInformation> const & tokenInformations,
+	ThreadPool & threadPool,
+	std::vector<SyntaxError> & syntaxErrors
+) const
+{
+	std::vector<size_t> boundaries;
+	FindStatementBoundaries(tokenInformations, boundaries);
+	size_t const segmentCount = std::min(boundaries.size(), threadPool.GetThreadCount() * SEGMENTS_PER_THREAD);
+	size_t const segmentTargetSize = tokenInformations.size() / std::max<size_t>(segmentCount, 1);
+	std::vector<size_t> segmentStarts { 0 };
+	for (size_t boundary : boundaries)
+	{
+		if (boundary - segmentStarts.back() >= segmentTargetSize && boundary != 0)
+		{
+			segmentStarts.emplace_back(boundary);
+		}
+	}
+	segmentStarts.emplace_back(tokenInformations.size());
+
+	size_t const segmentsSize = segmentStarts.size() - 1;
+	std::vector<SyntaxError> segmentErrors(segmentsSize);
+	std::vector<char> segmentResults(segmentsSize, false);
+	for (size_t i = 0; i < segmentsSize; ++i)
+	{
+		threadPool.Submit([this, &tokenInformations, &segmentStarts, &segmentErrors, &segmentResults, i]
+		{
+			segmentResults[i] = Validate(tokenInformations, segmentStarts[i], segmentStarts[i + 1], segmentErrors[i]);
+		});
+	}
+	threadPool.Wait();
+	if (std::all_of(segmentResults.begin(), segmentResults.end(), [](char segmentResult) { return segmentResult; }))
+	{
+		return true;
+	}
+	if (segmentsSize > 1)
+	{
+		// Statements split out of their context may be rejected on their own, so the whole input decides validity
+		SyntaxError syntaxError;
+		if (Validate(tokenInformations, 0, tokenInformations.size(), syntaxError))
+		{
+			return true;
+		}
+		bool isReported = false;
+		for (size_t i = 0; i < segmentsSize; ++i)
+		{
+			if (!segmentResults[i])
+			{
+				isReported = isReported || segmentErrors[i].failIndex == syntaxError.failIndex;
+				syntaxErrors.emplace_back(std::move(segmentErrors[i]));
+			}
+		}
+		if (!isReported)
+		{
+			syntaxErrors.emplace_back(std::move(syntaxError));
+		}
+		std::stable_sort(
+			syntaxErrors.begin(),
+			syntaxErrors.end(),
+			[](SyntaxError const & lhs, SyntaxError const & rhs)
+			{
+				return lhs.failIndex < rhs.failIndex;
+			}
+		);
+	}
+	else
+	{
+		syntaxErrors.emplace_back(std::move(segmentErrors.front()));
+	}
+	return false;
+}
+
+void SyntaxValidator::FindStatementBoundaries(
+	std::vector<TokenInformation> const & tokenInformations, std::vector<size_t> & boundaries
+) const
+{
+	boundaries.emplace_back(0);
+	if (!m_canSplit || tokenInformations.empty())
+	{
+		return;
+	}
+	long depth = 0;
+	for (size_t i = 0; i + 1 < tokenInformations.size(); ++i)
+	{
+		Token const token = tokenInformations[i].GetToken();
+		if (std::find(m_leftBrackets.begin(), m_leftBrackets.end(), token) != m_leftBrackets.end())
+		{
+			++depth;
+		}
+		else if (std::find(m_rightBrackets.begin(), m_rightBrackets.end(), token) != m_rightBrackets.end())
+		{
+			--depth;
+		}
+		bool const isStatementEnd = token == m_semicolon || token == m_rightBrackets.front();
+		if (depth != 0 || !isStatementEnd)
+		{
+			continue;
+		}
+		size_t nextIndex = FindNextSignificantTokenIndex(tokenInformations, i + 1);
+		if (nextIndex + 1 < tokenInformations.size() && tokenInformations[nextIndex].GetToken() != m_elseKeyword)
+		{
+			boundaries.emplace_back(i + 1);
+		}
+	}
+}
+
+bool SyntaxValidator::TryToResolveToken(std::string const & tokenName, Token & token)
+{
+	return TokenExtensions::CreateFromString(tokenName, token);
+}
+
+size_t SyntaxValidator::FindNextSignificantTokenIndex(std::vector<TokenInformation> const & tokenInformations, size_t index) const
+{
+	while (index < tokenInformations.size() && IsComment(tokenInformations[index].GetToken()))
+	{
+		++index;
+	}
+	return index;
+}
+
+bool SyntaxValidator::IsComment(Token token)
+{
+	return token == Token::LINE_COMMENT || token == Token::BLOCK_COMMENT;
+}
@@ -0,0 +1,47 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_SYNTAXVALIDATOR_H
+#define LLPARSERLIBRARYEXAMPLE_SYNTAXVALIDATOR_H
+
+#include "SyntaxError/SyntaxError.h"
+#include "../LLTableBuilderLibrary/Table/Table.h"
+#include "../LexerLibrary/TokenLibrary/Token.h"
+#include "../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include "../ThreadPool/ThreadPool.h"
+#include <string>
+#include <vector>
+
+// Runs the table driver without semantic actions, so it only answers whether the tokens are syntactically valid.
+// It never touches parser state, therefore one validator may be used from several threads at once.
+class SyntaxValidator
+{
+public:
+	explicit SyntaxValidator(Table const & table);
+
+	bool Validate(
+		std::vector<TokenInformation> const & tokenInformations,
+		size_t from,
+		size_t to,
+		SyntaxError & syntaxError
+	) const;
+	bool ValidateInParallel(
+		std::vector<TokenInformation> const & tokenInformations,
+		ThreadPool & threadPool,
+		std::vector<SyntaxError> & syntaxErrors
+	) const;
+	void FindStatementBoundaries(std::vector<TokenInformation> const & tokenInformations, std::vector<size_t> & boundaries) const;
+
+private:
+	static size_t const SEGMENTS_PER_THREAD = 4;
+
+	bool TryToResolveToken(std::string const & tokenName, Token & token);
+	size_t FindNextSignificantTokenIndex(std::vector<TokenInformation> const & tokenInformations, size_t index) const;
+	static bool IsComment(Token token);
+
+	Table const & m_table;
+	bool m_canSplit = true;
+	Token m_semicolon;
+	Token m_elseKeyword;
+	std::vector<Token> m_leftBrackets;
+	std::vector<Token> m_rightBrackets;
+};
+
+#endif
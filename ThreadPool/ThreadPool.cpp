@@ -0,0 +1,158 @@
+#include "ThreadPool.h"
+
+namespace
+{
+	thread_local ThreadPool const * currentThreadPool = nullptr;
+	thread_local size_t currentWorkerIndex = ThreadPool::NO_WORKER_INDEX;
+}
+
+ThreadPool::ThreadPool(size_t threadCount)
+{
+	if (threadCount == 0)
+	{
+		threadCount = 1;
+	}
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		m_queues.emplace_back(std::make_unique<WorkerQueue>());
+	}
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		m_threads.emplace_back(&ThreadPool::Work, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isStopped = true;
+	}
+	m_taskAvailable.notify_all();
+	for (std::thread & thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+void ThreadPool::Submit(std::function<void()> task)
+{
+	size_t queueIndex = GetCurrentWorkerIndex();
+	if (queueIndex == NO_WORKER_INDEX)
+	{
+		queueIndex = m_nextQueueIndex.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_unfinishedTaskCount;
+		m_queuedTaskCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	{
+		WorkerQueue & queue = *m_queues[queueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.emplace_back(std::move(task));
+	}
+	m_taskAvailable.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_tasksFinished.wait(lock, [this] { return m_unfinishedTaskCount == 0; });
+	if (m_taskException)
+	{
+		std::exception_ptr taskException = m_taskException;
+		m_taskException = nullptr;
+		std::rethrow_exception(taskException);
+	}
+}
+
+size_t ThreadPool::GetThreadCount() const
+{
+	return m_threads.size();
+}
+
+size_t ThreadPool::GetCurrentWorkerIndex() const
+{
+	return currentThreadPool == this ? currentWorkerIndex : NO_WORKER_INDEX;
+}
+
+void ThreadPool::Work(size_t workerIndex)
+{
+	currentThreadPool = this;
+	currentWorkerIndex = workerIndex;
+	while (true)
+	{
+		std::function<void()> task;
+		if (TryPopTask(workerIndex, task))
+		{
+			std::exception_ptr taskException;
+			try
+			{
+				task();
+			}
+			catch (...)
+			{
+				taskException = std::current_exception();
+			}
+			FinishTask(taskException);
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_taskAvailable.wait(lock, [this]
+		{
+			return m_isStopped || m_queuedTaskCount.load(std::memory_order_relaxed) != 0;
+		});
+		if (m_isStopped && m_queuedTaskCount.load(std::memory_order_relaxed) == 0)
+		{
+			return;
+		}
+	}
+}
+
+bool ThreadPool::TryPopTask(size_t workerIndex, std::function<void()> & task)
+{
+	{
+		WorkerQueue & queue = *m_queues[workerIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+			m_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+
+			return true;
+		}
+	}
+	for (size_t i = 1; i < m_queues.size(); ++i)
+	{
+		WorkerQueue & queue = *m_queues[(workerIndex + i) % m_queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			m_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::FinishTask(std::exception_ptr const & taskException)
+{
+	bool areAllTasksFinished;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (taskException && !m_taskException)
+		{
+			m_taskException = taskException;
+		}
+		areAllTasksFinished = --m_unfinishedTaskCount == 0;
+	}
+	if (areAllTasksFinished)
+	{
+		m_tasksFinished.notify_all();
+	}
+}
@@ -0,0 +1,53 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_THREADPOOL_H
+#define LLPARSERLIBRARYEXAMPLE_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool: every worker owns a deque, takes its own tasks from the back
+// and steals from the front of the other deques when it runs dry.
+class ThreadPool
+{
+public:
+	static size_t const NO_WORKER_INDEX = static_cast<size_t>(-1);
+
+	explicit ThreadPool(size_t threadCount);
+	~ThreadPool();
+
+	void Submit(std::function<void()> task);
+	void Wait();
+	size_t GetThreadCount() const;
+	size_t GetCurrentWorkerIndex() const;
+
+private:
+	class WorkerQueue
+	{
+	public:
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	void Work(size_t workerIndex);
+	bool TryPopTask(size_t workerIndex, std::function<void()> & task);
+	void FinishTask(std::exception_ptr const & taskException);
+
+	std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+	std::vector<std::thread> m_threads;
+	std::atomic<size_t> m_nextQueueIndex { 0 };
+	std::atomic<size_t> m_queuedTaskCount { 0 };
+	std::mutex m_mutex;
+	std::condition_variable m_taskAvailable;
+	std::condition_variable m_tasksFinished;
+	size_t m_unfinishedTaskCount = 0;
+	bool m_isStopped = false;
+	std::exception_ptr m_taskException;
+};
+
+#endif
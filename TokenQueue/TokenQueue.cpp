@@ -0,0 +1,113 @@
+#include "TokenQueue.h"
+#include <thread>
+
+TokenQueue::TokenQueue(size_t capacity)
+	: m_slots(capacity + 1)
+{
+}
+
+bool TokenQueue::TryPush(std::vector<TokenInformation> & batch)
+{
+	size_t const tail = m_tail.load(std::memory_order_relaxed);
+	size_t const nextTail = (tail + 1) % m_slots.size();
+	if (nextTail == m_head.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	m_slots[tail].swap(batch);
+	m_tail.store(nextTail, std::memory_order_release);
+	WakeWaiters();
+
+	return true;
+}
+
+bool TokenQueue::TryPop(std::vector<TokenInformation> & batch)
+{
+	size_t const head = m_head.load(std::memory_order_relaxed);
+	if (head == m_tail.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	m_slots[head].swap(batch);
+	m_head.store((head + 1) % m_slots.size(), std::memory_order_release);
+	WakeWaiters();
+
+	return true;
+}
+
+void TokenQueue::WaitForSpace(std::atomic<bool> const & isStopped)
+{
+	for (unsigned int i = 0; i < SPIN_COUNT; ++i)
+	{
+		if (!IsFull() || isStopped.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		std::this_thread::yield();
+	}
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_waiterCount.fetch_add(1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	m_condition.wait(lock, [this, &isStopped]()
+	{
+		return !IsFull() || isStopped.load(std::memory_order_relaxed);
+	});
+	m_waiterCount.fetch_sub(1);
+}
+
+void TokenQueue::WaitForBatch()
+{
+	for (unsigned int i = 0; i < SPIN_COUNT; ++i)
+	{
+		if (!IsEmpty() || IsClosed())
+		{
+			return;
+		}
+		std::this_thread::yield();
+	}
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_waiterCount.fetch_add(1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	m_condition.wait(lock, [this]()
+	{
+		return !IsEmpty() || IsClosed();
+	});
+	m_waiterCount.fetch_sub(1);
+}
+
+void TokenQueue::Close()
+{
+	m_isClosed.store(true, std::memory_order_release);
+	WakeAll();
+}
+
+void TokenQueue::WakeAll()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_condition.notify_all();
+}
+
+bool TokenQueue::IsClosed() const
+{
+	return m_isClosed.load(std::memory_order_acquire);
+}
+
+bool TokenQueue::IsFull() const
+{
+	return (m_tail.load(std::memory_order_acquire) + 1) % m_slots.size() == m_head.load(std::memory_order_acquire);
+}
+
+bool TokenQueue::IsEmpty() const
+{
+	return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+void TokenQueue::WakeWaiters()
+{
+	// Pairs with the fence after a waiter registers: either the waiter sees the new index or this sees the waiter
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_waiterCount.load(std::memory_order_relaxed) != 0)
+	{
+		WakeAll();
+	}
+}
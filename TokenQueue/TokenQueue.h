@@ -0,0 +1,42 @@
+#ifndef LLPARSERLIBRARYEXAMPLE_TOKENQUEUE_H
+#define LLPARSERLIBRARYEXAMPLE_TOKENQUEUE_H
+
+#include "../LexerLibrary/TokenLibrary/TokenInformation/TokenInformation.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+// Single-producer/single-consumer lock-free ring of token batches.
+// Batches are swapped in and out of the slots, so token vectors keep their capacity while circulating.
+// A side that cannot proceed spins briefly and then sleeps; the mutex is only touched when someone sleeps.
+class TokenQueue
+{
+public:
+	explicit TokenQueue(size_t capacity);
+
+	bool TryPush(std::vector<TokenInformation> & batch);
+	bool TryPop(std::vector<TokenInformation> & batch);
+	void WaitForSpace(std::atomic<bool> const & isStopped);
+	void WaitForBatch();
+	void Close();
+	void WakeAll();
+	bool IsClosed() const;
+
+private:
+	static unsigned int const SPIN_COUNT = 64;
+
+	bool IsFull() const;
+	bool IsEmpty() const;
+	void WakeWaiters();
+
+	std::vector<std::vector<TokenInformation>> m_slots;
+	alignas(64) std::atomic<size_t> m_head { 0 };
+	alignas(64) std::atomic<size_t> m_tail { 0 };
+	std::atomic<bool> m_isClosed { false };
+	std::atomic<unsigned int> m_waiterCount { 0 };
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+};
+
+#endif